@@ -44,6 +44,17 @@ static const std::string RANDOM_SEED_TAG = "random_seed";
 static const std::string INIT_MODEL_TAG = "init_model";
 static const std::string CLASSIFY_TAG = "classify";
 static const std::string THRESHOLD_TAG = "threshold";
+static const std::string GATHER_KERNEL_TAG = "gather_kernel";
+static const std::string RESIDUAL_CACHE_TAG = "residual_cache";
+static const std::string DEFERRED_STATS_TAG = "deferred_stats";
+static const std::string DEGREE_SCHEDULE_TAG = "degree_schedule";
+static const std::string TRANSPOSED_VALUES_TAG = "transposed_values";
+static const std::string MMAP_DATA_TAG = "mmap_data";
+static const std::string EMBED_DATA_TAG = "embed_data";
+static const std::string ASYNC_SAVE_TAG = "async_save";
+static const std::string SAMPLE_STORAGE_TAG = "sample_storage";
+static const std::string SAMPLE_COMPRESSION_TAG = "sample_compression";
+static const std::string PREDICT_MODE_TAG = "predict_mode";
 
 static const std::string LAMBDA_TAG = "prop_Lambda";
 static const std::string MU_TAG = "prop_mu";
@@ -58,6 +69,13 @@ static const std::string PRIOR_NAME_NORMALONE = "normalone";
 static const std::string MODEL_INIT_NAME_RANDOM = "random";
 static const std::string MODEL_INIT_NAME_ZERO = "zero";
 
+static const std::string SAMPLE_STORAGE_NAME_FULL = "full";
+static const std::string SAMPLE_STORAGE_NAME_FLOAT16 = "float16";
+static const std::string SAMPLE_STORAGE_NAME_UINT8 = "uint8";
+
+static const std::string PREDICT_MODE_NAME_SAMPLES = "samples";
+static const std::string PREDICT_MODE_NAME_SUMMARY = "summary";
+
 PriorTypes stringToPriorType(std::string name)
 {
    if(name == PRIOR_NAME_DEFAULT)
@@ -128,6 +146,64 @@ std::string modelInitTypeToString(ModelInitTypes type)
    }
 }
 
+SampleStorageTypes stringToSampleStorageType(std::string name)
+{
+   if(name == SAMPLE_STORAGE_NAME_FULL)
+      return SampleStorageTypes::full;
+   else if (name == SAMPLE_STORAGE_NAME_FLOAT16)
+      return SampleStorageTypes::float16;
+   else if (name == SAMPLE_STORAGE_NAME_UINT8)
+      return SampleStorageTypes::uint8;
+   else
+   {
+      THROWERROR("Invalid sample storage type " + name);
+   }
+}
+
+std::string sampleStorageTypeToString(SampleStorageTypes type)
+{
+   switch(type)
+   {
+      case SampleStorageTypes::full:
+         return SAMPLE_STORAGE_NAME_FULL;
+      case SampleStorageTypes::float16:
+         return SAMPLE_STORAGE_NAME_FLOAT16;
+      case SampleStorageTypes::uint8:
+         return SAMPLE_STORAGE_NAME_UINT8;
+      default:
+      {
+         THROWERROR("Invalid sample storage type");
+      }
+   }
+}
+
+PredictModes stringToPredictMode(std::string name)
+{
+   if(name == PREDICT_MODE_NAME_SAMPLES)
+      return PredictModes::samples;
+   else if (name == PREDICT_MODE_NAME_SUMMARY)
+      return PredictModes::summary;
+   else
+   {
+      THROWERROR("Invalid predict mode " + name);
+   }
+}
+
+std::string predictModeToString(PredictModes type)
+{
+   switch(type)
+   {
+      case PredictModes::samples:
+         return PREDICT_MODE_NAME_SAMPLES;
+      case PredictModes::summary:
+         return PREDICT_MODE_NAME_SUMMARY;
+      default:
+      {
+         THROWERROR("Invalid predict mode");
+      }
+   }
+}
+
 //config
 int Config::BURNIN_DEFAULT_VALUE = 200;
 int Config::NSAMPLES_DEFAULT_VALUE = 800;
@@ -144,6 +220,17 @@ const std::string Config::STATUS_DEFAULT_VALUE = "";
 bool Config::ENABLE_BETA_PRECISION_SAMPLING_DEFAULT_VALUE = true;
 double Config::THRESHOLD_DEFAULT_VALUE = 0.0;
 int Config::RANDOM_SEED_DEFAULT_VALUE = 0;
+bool Config::GATHER_KERNEL_DEFAULT_VALUE = true;
+bool Config::RESIDUAL_CACHE_DEFAULT_VALUE = false;
+bool Config::DEFERRED_STATS_DEFAULT_VALUE = false;
+bool Config::DEGREE_SCHEDULE_DEFAULT_VALUE = false;
+bool Config::TRANSPOSED_VALUES_DEFAULT_VALUE = false;
+bool Config::MMAP_DATA_DEFAULT_VALUE = false;
+bool Config::EMBED_DATA_DEFAULT_VALUE = true;
+bool Config::ASYNC_SAVE_DEFAULT_VALUE = false;
+SampleStorageTypes Config::SAMPLE_STORAGE_DEFAULT_VALUE = SampleStorageTypes::full;
+int Config::SAMPLE_COMPRESSION_DEFAULT_VALUE = 0;
+PredictModes Config::PREDICT_MODE_DEFAULT_VALUE = PredictModes::samples;
 
 Config::Config()
 {
@@ -156,6 +243,10 @@ Config::Config()
    m_save_pred = Config::SAVE_PRED_DEFAULT_VALUE;
    m_save_model = Config::SAVE_MODEL_DEFAULT_VALUE;
    m_checkpoint_freq = Config::CHECKPOINT_FREQ_DEFAULT_VALUE;
+   m_sample_storage = Config::SAMPLE_STORAGE_DEFAULT_VALUE;
+   m_sample_compression = Config::SAMPLE_COMPRESSION_DEFAULT_VALUE;
+
+   m_predict_mode = Config::PREDICT_MODE_DEFAULT_VALUE;
 
    m_random_seed_set = false;
    m_random_seed = Config::RANDOM_SEED_DEFAULT_VALUE;
@@ -166,6 +257,15 @@ Config::Config()
    m_num_latent = Config::NUM_LATENT_DEFAULT_VALUE;
    m_num_threads = Config::NUM_THREADS_DEFAULT_VALUE;
 
+   m_gather_kernel = Config::GATHER_KERNEL_DEFAULT_VALUE;
+   m_residual_cache = Config::RESIDUAL_CACHE_DEFAULT_VALUE;
+   m_deferred_stats = Config::DEFERRED_STATS_DEFAULT_VALUE;
+   m_degree_schedule = Config::DEGREE_SCHEDULE_DEFAULT_VALUE;
+   m_transposed_values = Config::TRANSPOSED_VALUES_DEFAULT_VALUE;
+   m_mmap_data = Config::MMAP_DATA_DEFAULT_VALUE;
+   m_embed_data = Config::EMBED_DATA_DEFAULT_VALUE;
+   m_async_save = Config::ASYNC_SAVE_DEFAULT_VALUE;
+
    m_threshold = Config::THRESHOLD_DEFAULT_VALUE;
    m_classify = false;
 }
@@ -288,6 +388,12 @@ bool Config::validate() const
          THROWERROR("Empty savename")
       }
 
+      // the state file is overwritten, while train data is mapped from it
+      if (getTrain().isMapped() && getSaveName() == getRestoreName())
+      {
+         THROWERROR("Train data is mapped from '" + getRestoreName() + "', save to a different file");
+      }
+
    }
 
    for(std::size_t i = 0; i < m_prior_types.size(); i++)
@@ -362,6 +468,9 @@ HDF5Group &Config::save(HDF5Group &cfg_file) const
    cfg_file.put(OPTIONS_SECTION_TAG, SAVE_PRED_TAG, m_save_pred);
    cfg_file.put(OPTIONS_SECTION_TAG, SAVE_MODEL_TAG, m_save_model);
    cfg_file.put(OPTIONS_SECTION_TAG, CHECKPOINT_FREQ_TAG, m_checkpoint_freq);
+   cfg_file.put(OPTIONS_SECTION_TAG, SAMPLE_STORAGE_TAG, sampleStorageTypeToString(m_sample_storage));
+   cfg_file.put(OPTIONS_SECTION_TAG, SAMPLE_COMPRESSION_TAG, m_sample_compression);
+   cfg_file.put(OPTIONS_SECTION_TAG, PREDICT_MODE_TAG, predictModeToString(m_predict_mode));
 
    //general data
    cfg_file.put(OPTIONS_SECTION_TAG, VERBOSE_TAG, m_verbose);
@@ -372,16 +481,24 @@ HDF5Group &Config::save(HDF5Group &cfg_file) const
    cfg_file.put(OPTIONS_SECTION_TAG, RANDOM_SEED_SET_TAG, m_random_seed_set);
    cfg_file.put(OPTIONS_SECTION_TAG, RANDOM_SEED_TAG, m_random_seed);
    cfg_file.put(OPTIONS_SECTION_TAG, INIT_MODEL_TAG, modelInitTypeToString(m_model_init_type));
+   cfg_file.put(OPTIONS_SECTION_TAG, GATHER_KERNEL_TAG, m_gather_kernel);
+   cfg_file.put(OPTIONS_SECTION_TAG, RESIDUAL_CACHE_TAG, m_residual_cache);
+   cfg_file.put(OPTIONS_SECTION_TAG, DEFERRED_STATS_TAG, m_deferred_stats);
+   cfg_file.put(OPTIONS_SECTION_TAG, DEGREE_SCHEDULE_TAG, m_degree_schedule);
+   cfg_file.put(OPTIONS_SECTION_TAG, TRANSPOSED_VALUES_TAG, m_transposed_values);
+   cfg_file.put(OPTIONS_SECTION_TAG, MMAP_DATA_TAG, m_mmap_data);
+   cfg_file.put(OPTIONS_SECTION_TAG, EMBED_DATA_TAG, m_embed_data);
+   cfg_file.put(OPTIONS_SECTION_TAG, ASYNC_SAVE_TAG, m_async_save);
 
    //probit prior data
    cfg_file.put(OPTIONS_SECTION_TAG, CLASSIFY_TAG, m_classify);
    cfg_file.put(OPTIONS_SECTION_TAG, THRESHOLD_TAG, m_threshold);
 
    //write train data section
-   getTrain().save(cfg_file, TRAIN_SECTION_TAG);
+   getTrain().save(cfg_file, TRAIN_SECTION_TAG, m_mmap_data, m_embed_data);
 
    //write test data section
-   getTest().save(cfg_file, TEST_SECTION_TAG);
+   getTest().save(cfg_file, TEST_SECTION_TAG, false, m_embed_data);
 
    //write macau prior configs section
    for (auto p : m_sideInfoConfigs)
@@ -393,7 +510,7 @@ HDF5Group &Config::save(HDF5Group &cfg_file) const
 
    //write data section -- excluding train
    for (std::size_t sIndex = 1; sIndex < m_data.size(); sIndex++)
-      m_data.at(sIndex).save(cfg_file, addIndex(AUX_DATA_PREFIX, sIndex-1));
+      m_data.at(sIndex).save(cfg_file, addIndex(AUX_DATA_PREFIX, sIndex-1), m_mmap_data, m_embed_data);
 
    //write posterior propagation
    for (std::size_t pIndex = 0; pIndex < m_prior_types.size(); pIndex++)
@@ -456,6 +573,9 @@ bool Config::restore(const HDF5Group &cfg_file)
    m_save_pred  = cfg_file.get(OPTIONS_SECTION_TAG, SAVE_PRED_TAG, Config::SAVE_PRED_DEFAULT_VALUE);
    m_save_model = cfg_file.get(OPTIONS_SECTION_TAG, SAVE_MODEL_TAG, Config::SAVE_MODEL_DEFAULT_VALUE);
    m_checkpoint_freq = cfg_file.get(OPTIONS_SECTION_TAG, CHECKPOINT_FREQ_TAG, Config::CHECKPOINT_FREQ_DEFAULT_VALUE);
+   m_sample_storage = stringToSampleStorageType(cfg_file.get(OPTIONS_SECTION_TAG, SAMPLE_STORAGE_TAG, sampleStorageTypeToString(Config::SAMPLE_STORAGE_DEFAULT_VALUE)));
+   m_sample_compression = cfg_file.get(OPTIONS_SECTION_TAG, SAMPLE_COMPRESSION_TAG, Config::SAMPLE_COMPRESSION_DEFAULT_VALUE);
+   m_predict_mode = stringToPredictMode(cfg_file.get(OPTIONS_SECTION_TAG, PREDICT_MODE_TAG, predictModeToString(Config::PREDICT_MODE_DEFAULT_VALUE)));
 
    //restore general data
    m_verbose = cfg_file.get(OPTIONS_SECTION_TAG, VERBOSE_TAG, Config::VERBOSE_DEFAULT_VALUE);
@@ -466,6 +586,14 @@ bool Config::restore(const HDF5Group &cfg_file)
    m_random_seed_set = cfg_file.get(OPTIONS_SECTION_TAG, RANDOM_SEED_SET_TAG,  false);
    m_random_seed = cfg_file.get(OPTIONS_SECTION_TAG, RANDOM_SEED_TAG, Config::RANDOM_SEED_DEFAULT_VALUE);
    m_model_init_type = stringToModelInitType(cfg_file.get(OPTIONS_SECTION_TAG, INIT_MODEL_TAG, modelInitTypeToString(Config::INIT_MODEL_DEFAULT_VALUE)));
+   m_gather_kernel = cfg_file.get(OPTIONS_SECTION_TAG, GATHER_KERNEL_TAG, Config::GATHER_KERNEL_DEFAULT_VALUE);
+   m_residual_cache = cfg_file.get(OPTIONS_SECTION_TAG, RESIDUAL_CACHE_TAG, Config::RESIDUAL_CACHE_DEFAULT_VALUE);
+   m_deferred_stats = cfg_file.get(OPTIONS_SECTION_TAG, DEFERRED_STATS_TAG, Config::DEFERRED_STATS_DEFAULT_VALUE);
+   m_degree_schedule = cfg_file.get(OPTIONS_SECTION_TAG, DEGREE_SCHEDULE_TAG, Config::DEGREE_SCHEDULE_DEFAULT_VALUE);
+   m_transposed_values = cfg_file.get(OPTIONS_SECTION_TAG, TRANSPOSED_VALUES_TAG, Config::TRANSPOSED_VALUES_DEFAULT_VALUE);
+   m_mmap_data = cfg_file.get(OPTIONS_SECTION_TAG, MMAP_DATA_TAG, Config::MMAP_DATA_DEFAULT_VALUE);
+   m_embed_data = cfg_file.get(OPTIONS_SECTION_TAG, EMBED_DATA_TAG, Config::EMBED_DATA_DEFAULT_VALUE);
+   m_async_save = cfg_file.get(OPTIONS_SECTION_TAG, ASYNC_SAVE_TAG, Config::ASYNC_SAVE_DEFAULT_VALUE);
 
    //restore probit prior data
    m_classify = cfg_file.get(OPTIONS_SECTION_TAG, CLASSIFY_TAG,  false);
@@ -31,6 +31,22 @@ enum class ModelInitTypes
    zero
 };
 
+// how the latent matrices of saved samples are stored, see HDF5Group::write
+enum class SampleStorageTypes
+{
+   full,
+   float16,
+   uint8
+};
+
+// how PredictSession predicts: averaging over all samples, or in closed form from the
+// posterior mean and second moment of each row saved with the last sample
+enum class PredictModes
+{
+   samples,
+   summary
+};
+
 
 PriorTypes stringToPriorType(std::string name);
 
@@ -40,6 +56,14 @@ ModelInitTypes stringToModelInitType(std::string name);
 
 std::string modelInitTypeToString(ModelInitTypes type);
 
+SampleStorageTypes stringToSampleStorageType(std::string name);
+
+std::string sampleStorageTypeToString(SampleStorageTypes type);
+
+PredictModes stringToPredictMode(std::string name);
+
+std::string predictModeToString(PredictModes type);
+
 struct Config
 {
 public:
@@ -61,6 +85,17 @@ public:
    static bool ENABLE_BETA_PRECISION_SAMPLING_DEFAULT_VALUE;
    static double THRESHOLD_DEFAULT_VALUE;
    static int RANDOM_SEED_DEFAULT_VALUE;
+   static bool GATHER_KERNEL_DEFAULT_VALUE;
+   static bool RESIDUAL_CACHE_DEFAULT_VALUE;
+   static bool DEFERRED_STATS_DEFAULT_VALUE;
+   static bool DEGREE_SCHEDULE_DEFAULT_VALUE;
+   static bool TRANSPOSED_VALUES_DEFAULT_VALUE;
+   static bool MMAP_DATA_DEFAULT_VALUE;
+   static bool EMBED_DATA_DEFAULT_VALUE;
+   static bool ASYNC_SAVE_DEFAULT_VALUE;
+   static SampleStorageTypes SAMPLE_STORAGE_DEFAULT_VALUE;
+   static int SAMPLE_COMPRESSION_DEFAULT_VALUE;
+   static PredictModes PREDICT_MODE_DEFAULT_VALUE;
 
 private:
    //-- train and test
@@ -89,6 +124,11 @@ private:
    bool m_save_pred;
    bool m_save_model;
    int m_checkpoint_freq;
+   SampleStorageTypes m_sample_storage;
+   int m_sample_compression;
+
+   //-- predict
+   PredictModes m_predict_mode;
 
    //-- general
    bool m_random_seed_set;
@@ -99,6 +139,16 @@ private:
    int m_num_latent;
    int m_num_threads; 
 
+   //-- compute kernels
+   bool m_gather_kernel;
+   bool m_residual_cache;
+   bool m_deferred_stats;
+   bool m_degree_schedule;
+   bool m_transposed_values;
+   bool m_mmap_data;
+   bool m_embed_data;
+   bool m_async_save;
+
    //-- binary classification
    bool m_classify;
    double m_threshold;
@@ -289,6 +339,56 @@ public:
       m_model_init_type = stringToModelInitType(value);
    }
 
+   SampleStorageTypes getSampleStorage() const
+   {
+      return m_sample_storage;
+   }
+
+   void setSampleStorage(SampleStorageTypes value)
+   {
+      m_sample_storage = value;
+   }
+
+   std::string getSampleStorageAsString() const
+   {
+      return sampleStorageTypeToString(m_sample_storage);
+   }
+
+   void setSampleStorage(std::string value)
+   {
+      m_sample_storage = stringToSampleStorageType(value);
+   }
+
+   PredictModes getPredictMode() const
+   {
+      return m_predict_mode;
+   }
+
+   void setPredictMode(PredictModes value)
+   {
+      m_predict_mode = value;
+   }
+
+   std::string getPredictModeAsString() const
+   {
+      return predictModeToString(m_predict_mode);
+   }
+
+   void setPredictMode(std::string value)
+   {
+      m_predict_mode = stringToPredictMode(value);
+   }
+
+   int getSampleCompression() const
+   {
+      return m_sample_compression;
+   }
+
+   void setSampleCompression(int value)
+   {
+      m_sample_compression = value;
+   }
+
    std::string getRestoreName() const 
    {
       return m_restore_name;
@@ -444,6 +544,86 @@ public:
        m_num_threads = value;
    }
 
+   bool getGatherKernel() const
+   {
+       return m_gather_kernel;
+   }
+
+   void setGatherKernel(bool value)
+   {
+       m_gather_kernel = value;
+   }
+
+   bool getResidualCache() const
+   {
+       return m_residual_cache;
+   }
+
+   void setResidualCache(bool value)
+   {
+       m_residual_cache = value;
+   }
+
+   bool getDeferredStats() const
+   {
+       return m_deferred_stats;
+   }
+
+   void setDeferredStats(bool value)
+   {
+       m_deferred_stats = value;
+   }
+
+   bool getDegreeSchedule() const
+   {
+       return m_degree_schedule;
+   }
+
+   void setDegreeSchedule(bool value)
+   {
+       m_degree_schedule = value;
+   }
+
+   bool getTransposedValues() const
+   {
+       return m_transposed_values;
+   }
+
+   void setTransposedValues(bool value)
+   {
+       m_transposed_values = value;
+   }
+
+   bool getMmapData() const
+   {
+       return m_mmap_data;
+   }
+
+   void setMmapData(bool value)
+   {
+       m_mmap_data = value;
+   }
+
+   bool getEmbedData() const
+   {
+       return m_embed_data;
+   }
+
+   void setEmbedData(bool value)
+   {
+       m_embed_data = value;
+   }
+
+   bool getAsyncSave() const
+   {
+       return m_async_save;
+   }
+
+   void setAsyncSave(bool value)
+   {
+       m_async_save = value;
+   }
+
    std::string getIniName() const
    {
        return m_ini_name;
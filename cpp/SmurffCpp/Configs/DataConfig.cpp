@@ -1,11 +1,13 @@
 #include "DataConfig.h"
 
 #include <numeric>
+#include <utility>
 
 #include <SmurffCpp/Utils/PVec.hpp>
 #include <SmurffCpp/Utils/HDF5Group.h>
 #include <SmurffCpp/Utils/Error.h>
 #include <SmurffCpp/Utils/StringUtils.h>
+#include <SmurffCpp/Utils/GenericIO.h>
 
 namespace smurff {
 
@@ -16,6 +18,10 @@ static const std::string SCARCE_TAG = "scarce";
 static const std::string SPARSE_TAG = "sparse";
 static const std::string MATRIX_TAG = "matrix";
 static const std::string TYPE_TAG = "type";
+static const std::string FILE_TAG = "file";
+static const std::string FILE_HASH_TAG = "file_hash";
+static const std::string NROW_TAG = "nrow";
+static const std::string NCOL_TAG = "ncol";
 
 static const std::string NONE_VALUE("none");
 
@@ -94,26 +100,39 @@ const std::string NON_FINITE_MSG = "Found nan/infinite in input data";
 
 void DataConfig::setData(const Matrix &m)
 {
-   m_dense_matrix_data = m;
+   setData(Matrix(m));
+}
+
+void DataConfig::setData(const SparseMatrix &m, bool isScarce)
+{
+   setData(SparseMatrix(m), isScarce);
+}
+
+void DataConfig::setData(Matrix &&m)
+{
+   m_dense_matrix_data = std::move(m);
    m_hasData = true;
+   m_file_hash.clear();
    m_isDense = true;
    m_isScarce = false;
    m_isMatrix = true;
 
-   THROWERROR_ASSERT_MSG(m.array().isFinite().all(), NON_FINITE_MSG);
+   THROWERROR_ASSERT_MSG(m_dense_matrix_data.array().isFinite().all(), NON_FINITE_MSG);
 
    check();
 }
 
-void DataConfig::setData(const SparseMatrix &m, bool isScarce)
+void DataConfig::setData(SparseMatrix &&m, bool isScarce)
 {
-   m_sparse_matrix_data = m;
+   m_sparse_matrix_data = std::move(m);
+   m_mapped_sparse_matrix_data = MappedSparseMatrix();
    m_hasData = true;
+   m_file_hash.clear();
    m_isDense = false;
    m_isScarce = isScarce;
    m_isMatrix = true;
 
-   const Eigen::Map<const Vector> values(m.valuePtr(), m.nonZeros());
+   const Eigen::Map<const Vector> values(m_sparse_matrix_data.valuePtr(), m_sparse_matrix_data.nonZeros());
    THROWERROR_ASSERT_MSG(values.array().isFinite().all(), NON_FINITE_MSG);
 
    check();
@@ -123,6 +142,7 @@ void DataConfig::setData(const DenseTensor &m)
 {
    m_dense_tensor_data = m;
    m_hasData = true;
+   m_file_hash.clear();
    m_isDense = true;
    m_isMatrix = false;
 
@@ -136,6 +156,7 @@ void DataConfig::setData(const SparseTensor &m, bool isScarce)
 {
    m_sparse_tensor_data = m;
    m_hasData = true;
+   m_file_hash.clear();
    m_isDense = false;
    m_isScarce = isScarce;
    m_isMatrix = false;
@@ -154,10 +175,16 @@ const Matrix &DataConfig::getDenseMatrixData() const
 
 const SparseMatrix &DataConfig::getSparseMatrixData() const
 {
-   THROWERROR_ASSERT(hasData() && !isDense() && isMatrix());
+   THROWERROR_ASSERT(hasData() && !isDense() && isMatrix() && !isMapped());
    return m_sparse_matrix_data;
 }
 
+const MappedSparseMatrix &DataConfig::getMappedSparseMatrixData() const
+{
+   THROWERROR_ASSERT(hasData() && isMapped());
+   return m_mapped_sparse_matrix_data;
+}
+
 const SparseTensor &DataConfig::getSparseTensorData() const
 {
    THROWERROR_ASSERT(hasData() && !isDense() && !isMatrix());
@@ -214,11 +241,17 @@ bool DataConfig::isMatrix() const
    return m_isMatrix;
 }
 
+bool DataConfig::isMapped() const
+{
+   return (bool)m_mapped_sparse_matrix_data.file;
+}
+
 std::uint64_t DataConfig::getNNZ() const
 {
    THROWERROR_ASSERT(hasData());
 
-        if (isMatrix() && isDense())        return getDenseMatrixData().nonZeros();
+        if (isMapped())                     return getMappedSparseMatrixData().nnz;
+   else if (isMatrix() && isDense())        return getDenseMatrixData().nonZeros();
    else if (isMatrix() && !isDense())  return getSparseMatrixData().nonZeros();
    else if (!isMatrix() && !isDense()) return getSparseTensorData().getNNZ();
    else if (!isMatrix() && isDense())  return getDenseTensorData().getNNZ();
@@ -234,7 +267,12 @@ const std::vector<std::uint64_t> DataConfig::getDims() const
 {
    THROWERROR_ASSERT(hasData());
 
-   if (isMatrix() && isDense())
+   if (isMapped())
+   {
+      const auto &m = getMappedSparseMatrixData();
+      return std::vector<std::uint64_t>{ (std::uint64_t)m.rows, (std::uint64_t)m.cols };
+   }
+   else if (isMatrix() && isDense())
    {
       const auto &m = getDenseMatrixData();
       return std::vector<std::uint64_t>{ (std::uint64_t)m.rows(), (std::uint64_t)m.cols() };
@@ -275,6 +313,16 @@ void DataConfig::setFilename(const std::string &f)
     m_filename = f;
 }
 
+void DataConfig::setFileHash(const std::string &h)
+{
+    m_file_hash = h;
+}
+
+const std::string &DataConfig::getFileHash() const
+{
+    return m_file_hash;
+}
+
 const std::string &DataConfig::getFilename() const
 {
     return m_filename;
@@ -326,7 +374,7 @@ std::string DataConfig::info() const
     return ss.str();
 }
 
-void DataConfig::save(HDF5Group& cfg_file, const std::string& sectionName) const
+void DataConfig::save(HDF5Group& cfg_file, const std::string& sectionName, bool transposed_index, bool embed) const
 {
    if (!hasData())
       return;
@@ -339,10 +387,27 @@ void DataConfig::save(HDF5Group& cfg_file, const std::string& sectionName) const
       cfg_file.put(sectionName, POS_TAG, ss.str());
    }
 
-   if (isMatrix() && isDense())
+   if (!embed && getFileHash().size())
+   {
+      cfg_file.put(sectionName, FILE_TAG, getFilename());
+      cfg_file.put(sectionName, FILE_HASH_TAG, getFileHash());
+
+      // not all files store their size
+      if (isMatrix())
+      {
+         cfg_file.put(sectionName, NROW_TAG, (int)getNRow());
+         cfg_file.put(sectionName, NCOL_TAG, (int)getNCol());
+      }
+   }
+   else if (isMapped())
+   {
+      const auto &m = getMappedSparseMatrixData();
+      cfg_file.write(sectionName, DATA_TAG, SparseMatrixMap(m.rows, m.cols, m.nnz, m.outer, m.inner, m.values), transposed_index);
+   }
+   else if (isMatrix() && isDense())
       cfg_file.write(sectionName, DATA_TAG, getDenseMatrixData());
    else if (isMatrix() && !isDense())
-      cfg_file.write(sectionName, DATA_TAG, getSparseMatrixData());
+      cfg_file.write(sectionName, DATA_TAG, getSparseMatrixData(), transposed_index);
    else if (!isMatrix() && !isDense())
       cfg_file.write(sectionName, DATA_TAG, getSparseTensorData());
    else if (!isMatrix() && isDense())
@@ -389,10 +454,20 @@ bool DataConfig::restore(const HDF5Group& cfg_file, const std::string& sectionNa
    m_isScarce = cfg_file.get(sectionName, TYPE_TAG, SCARCE_TAG) == SCARCE_TAG;
    m_isMatrix = cfg_file.get(sectionName, MATRIX_TAG, true);
 
-   if (isMatrix() && isDense())
+   m_mapped_sparse_matrix_data = MappedSparseMatrix();
+
+   const std::string filename = cfg_file.get(sectionName, FILE_TAG, NONE_VALUE);
+   if (filename != NONE_VALUE)
+      generic_io::read_data_config(filename, isScarce(), *this, true, cfg_file.get(sectionName, FILE_HASH_TAG, NONE_VALUE),
+                                   cfg_file.get(sectionName, NROW_TAG, -1), cfg_file.get(sectionName, NCOL_TAG, -1));
+   else if (isMatrix() && isDense())
       cfg_file.read(sectionName, DATA_TAG, getDenseMatrixData());
    else if (isMatrix() && !isDense())
-      cfg_file.read(sectionName, DATA_TAG, getSparseMatrixData());
+   {
+      // zero-copy when written with its transposed index
+      if (!cfg_file.map(sectionName, DATA_TAG, m_mapped_sparse_matrix_data))
+         cfg_file.read(sectionName, DATA_TAG, getSparseMatrixData());
+   }
    else if (!isMatrix() && !isDense())
       cfg_file.read(sectionName, DATA_TAG, getSparseTensorData());
    else if (!isMatrix() && isDense())
@@ -8,6 +8,7 @@
 
 #include <SmurffCpp/Types.h>
 #include <SmurffCpp/Utils/PVec.hpp>
+#include <SmurffCpp/Utils/MappedFile.h>
 #include <SmurffCpp/Configs/NoiseConfig.h>
 
 namespace smurff
@@ -29,12 +30,16 @@ namespace smurff
    private:
       PVec<>      m_pos;
       std::string m_filename;
+      std::string m_file_hash; // content hash of m_filename when the data was read
 
       Matrix       m_dense_matrix_data;
       SparseMatrix m_sparse_matrix_data;
       DenseTensor  m_dense_tensor_data;
       SparseTensor m_sparse_tensor_data;
 
+      // sparse matrix mapped from the state file instead of m_sparse_matrix_data
+      MappedSparseMatrix m_mapped_sparse_matrix_data;
+
    public:
       virtual ~DataConfig();
 
@@ -48,6 +53,8 @@ namespace smurff
    public:
       void setData(const Matrix &m);
       void setData(const SparseMatrix &m, bool isScarce = true);
+      void setData(Matrix &&m);
+      void setData(SparseMatrix &&m, bool isScarce = true);
       void setData(const DenseTensor &m);
       void setData(const SparseTensor &m, bool isScarce = true);
 
@@ -55,6 +62,7 @@ namespace smurff
       const SparseMatrix &getSparseMatrixData() const;
       const SparseTensor &getSparseTensorData() const;
       const DenseTensor  &getDenseTensorData() const;
+      const MappedSparseMatrix &getMappedSparseMatrixData() const;
 
       Matrix       &getDenseMatrixData();
       SparseMatrix &getSparseMatrixData();
@@ -68,6 +76,7 @@ namespace smurff
       bool isMatrix() const;
       bool isDense() const;
       bool isScarce() const;
+      bool isMapped() const;
 
       std::uint64_t getNModes() const;
       std::uint64_t getNNZ() const;
@@ -79,6 +88,9 @@ namespace smurff
       void setFilename(const std::string& f);
       const std::string &getFilename() const;
 
+      void setFileHash(const std::string& h);
+      const std::string &getFileHash() const;
+
       void setPos(const PVec<>& p);
       void setPos(const std::vector<int> &p) { setPos(PVec<>(p)); }
       bool hasPos() const;
@@ -88,7 +100,9 @@ namespace smurff
       virtual std::ostream& info(std::ostream& os) const;
       virtual std::string info() const;
 
-      void save(HDF5Group& writer, const std::string& section_name) const;
+      // with transposed_index, a sparse matrix is written so that restore can map it
+      // without embed, data read from a file is written as its filename and hash, and read again by restore
+      void save(HDF5Group& writer, const std::string& section_name, bool transposed_index = false, bool embed = true) const;
       bool restore(const HDF5Group& reader, const std::string& sec_name);
 
    public:
@@ -1,4 +1,6 @@
 #include <memory>
+#include <numeric>
+#include <algorithm>
 
 #include "Data.h"
 #include <SmurffCpp/Utils/Error.h>
@@ -11,6 +13,7 @@
 
 //tensor classes
 #include <SmurffCpp/DataTensors/TensorData.h>
+#include <SmurffCpp/DataTensors/DenseTensorData.h>
 
 //noise classes
 #include <SmurffCpp/Configs/NoiseConfig.h>
@@ -29,10 +32,16 @@ void Data::init()
     init_pre();
 
     init_post();
+
+    if (getDegreeSchedule())
+       init_sample_order();
 }
 
 void Data::init_post()
 {
+   if (getResidualCache())
+      m_residuals.setZero(nnz());
+
    noise().init(this);
 }
 
@@ -41,6 +50,71 @@ void Data::update(const SubModel& model)
    noise().update(model);
 }
 
+bool Data::hasSharedPrecision(uint32_t mode) const
+{
+   return false;
+}
+
+void Data::getSharedLambda(const SubModel& model, uint32_t mode, Matrix& MM) const
+{
+   THROWERROR_NOTIMPL();
+}
+
+void Data::getMu(const SubModel& model, uint32_t mode, int d, Vector& rr) const
+{
+   THROWERROR_NOTIMPL();
+}
+
+bool Data::getMuLowRank(const SubModel& model, uint32_t mode, int d, int max_rank, Vector& rr, Matrix& Vd, int& rank) const
+{
+   return false;
+}
+
+void Data::update_residuals(const SubModel& model, uint32_t mode, int d)
+{
+}
+
+std::uint64_t Data::row_nnz(uint32_t mode, int d) const
+{
+   return (size() - nna()) / dim(mode);
+}
+
+void Data::init_sample_order()
+{
+   m_sample_order.resize(nmode());
+   for (std::uint64_t mode = 0; mode < nmode(); ++mode)
+   {
+      std::vector<std::uint64_t> degree(dim(mode));
+      for (int d = 0; d < dim(mode); ++d)
+         degree[d] = row_nnz(mode, d);
+
+      // heaviest rows first, so they do not end up in the tail of the sweep
+      auto &order = m_sample_order[mode];
+      order.resize(dim(mode));
+      std::iota(order.begin(), order.end(), 0);
+      std::stable_sort(order.begin(), order.end(), [&degree](int a, int b) { return degree[a] > degree[b]; });
+   }
+}
+
+const std::vector<int> &Data::getSampleOrder(uint32_t mode) const
+{
+   static const std::vector<int> natural_order;
+   return m_sample_order.empty() ? natural_order : m_sample_order.at(mode);
+}
+
+double Data::sumsq_residuals() const
+{
+   THROWERROR_ASSERT(m_residuals_valid);
+
+   double sumsq = 0.0;
+
+   #pragma omp parallel for schedule(static) reduction(+:sumsq)
+   for (Eigen::Index i = 0; i < m_residuals.size(); ++i)
+      sumsq += m_residuals(i) * m_residuals(i);
+
+   return sumsq;
+}
+
 //#### dimension functions ####
 
 std::uint64_t Data::size() const
@@ -93,6 +167,8 @@ std::ostream& Data::info(std::ostream& os, std::string indent)
    os << indent << "Type: " << name << std::endl;
    os << indent << "Component-wise mean: " << cwise_mean << std::endl;
    os << indent << "Component-wise variance: " << var_total() << std::endl;
+   if (getResidualCache())
+      os << indent << "Residual cache: " << m_residuals.size() << " x " << sizeof(float_type) << " bytes" << std::endl;
    os << indent << "Noise: ";
    noise().info(os, "");
    return os;
@@ -104,10 +180,12 @@ std::ostream& Data::status(std::ostream& os, std::string indent) const
    return os;
 }
 
-std::shared_ptr<Data> Data::create(const std::vector<DataConfig> &dcs)
+std::shared_ptr<Data> Data::create(const Config &config)
 {
+   const auto &dcs = config.getData();
+
    //create single matrix or tensor -- only train
-   if (dcs.size() == 1) return Data::create(dcs.at(0));
+   if (dcs.size() == 1) return Data::create(dcs.at(0), config);
 
    //multiple matrices
    THROWERROR_ASSERT_MSG(dcs.at(0).isMatrix(), "Tensor config does not support aux data");
@@ -117,12 +195,13 @@ std::shared_ptr<Data> Data::create(const std::vector<DataConfig> &dcs)
    data_ptr->setNoiseModel(NoiseFactory::create_noise_model(ncfg));
 
    for (auto &m : dcs)
-      data_ptr->add(m.getPos(), Data::create(m));
+      data_ptr->add(m.getPos(), Data::create(m, config));
 
+   data_ptr->setDegreeSchedule(config.getDegreeSchedule());
    return data_ptr;
 }
 
-std::shared_ptr<Data> Data::create(const DataConfig& dc) 
+std::shared_ptr<Data> Data::create(const DataConfig& dc, const Config &config)
 {
    std::shared_ptr<Data> ret;
 
@@ -131,21 +210,39 @@ std::shared_ptr<Data> Data::create(const DataConfig& dc)
       if (dc.isDense())
         ret = std::make_shared<DenseMatrixData>(dc.getDenseMatrixData());
       else if (!dc.isScarce())
-        ret = std::make_shared<SparseMatrixData>(dc.getSparseMatrixData());
+      {
+        auto sparse = dc.isMapped() ? std::make_shared<SparseMatrixData>(dc.getMappedSparseMatrixData())
+                                    : std::make_shared<SparseMatrixData>(dc.getSparseMatrixData());
+        sparse->setTransposedValues(config.getTransposedValues());
+        ret = sparse;
+      }
       else
-        ret = std::make_shared<ScarceMatrixData>(dc.getSparseMatrixData());
+      {
+        auto scarce = dc.isMapped() ? std::make_shared<ScarceMatrixData>(dc.getMappedSparseMatrixData())
+                                    : std::make_shared<ScarceMatrixData>(dc.getSparseMatrixData());
+        scarce->setResidualCache(config.getResidualCache());
+        scarce->setGatherKernel(config.getGatherKernel());
+        scarce->setTransposedValues(config.getTransposedValues());
+        ret = scarce;
+      }
    }
    else
    {
       if (dc.isDense())
-         ret = std::make_shared<TensorData>(dc.getDenseTensorData());
-      else if (!dc.isScarce())
-        ret = std::make_shared<TensorData>(dc.getSparseTensorData()); // FIXME
+         ret = std::make_shared<DenseTensorData>(dc.getDenseTensorData());
       else
-        ret = std::make_shared<TensorData>(dc.getSparseTensorData()); // FIXME
+      {
+         if (!dc.isScarce())
+           ret = std::make_shared<TensorData>(dc.getSparseTensorData()); // FIXME
+         else
+           ret = std::make_shared<TensorData>(dc.getSparseTensorData()); // FIXME
+
+         ret->setResidualCache(config.getResidualCache());
+      }
    }
 
    ret->setNoiseModel(NoiseFactory::create_noise_model(dc.getNoiseConfig()));
+   ret->setDegreeSchedule(config.getDegreeSchedule());
    return ret;
 }
 
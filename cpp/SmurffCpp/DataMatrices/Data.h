@@ -69,10 +69,56 @@ namespace smurff
       virtual void update_pnm(const SubModel& model, uint32_t mode) = 0;
       virtual void getMuLambda(const SubModel& model, uint32_t mode, int d, Vector& rr, Matrix& MM) const = 0;
 
+      // when the precision added by getMuLambda is identical for all rows in mode,
+      // priors can factor it once and only ask for the per-row mean with getMu
+      virtual bool hasSharedPrecision(uint32_t mode) const;
+      virtual void getSharedLambda(const SubModel& model, uint32_t mode, Matrix& MM) const;
+      virtual void getMu(const SubModel& model, uint32_t mode, int d, Vector& rr) const;
+
+      // for rows with less than max_rank observations: adds the mean to rr and fills the first
+      // rank rows of Vd (at least max_rank x num_latent) such that the precision is Vd^T * Vd,
+      // returns false otherwise (rr untouched)
+      virtual bool getMuLowRank(const SubModel& model, uint32_t mode, int d, int max_rank, Vector& rr, Matrix& Vd, int& rank) const;
+
    public:
       virtual double sumsq(const SubModel& model) const = 0;
       virtual double var_total() const = 0;
 
+   //#### residual cache ####
+   protected:
+      // residuals (pred - y) per non-zero, in the storage order of the last mode,
+      // filled by update_residuals while the last mode is sampled
+      Array1D m_residuals;
+      bool m_use_residual_cache = false;
+      bool m_residuals_valid = false;
+
+      double sumsq_residuals() const;
+
+   public:
+      void setResidualCache(bool value) { m_use_residual_cache = value; }
+      bool getResidualCache() const { return m_use_residual_cache; }
+
+   //#### sampling schedule ####
+   private:
+      // per mode: row indices by decreasing row_nnz, filled in init() when enabled
+      std::vector<std::vector<int>> m_sample_order;
+      bool m_use_degree_schedule = false;
+
+      void init_sample_order();
+
+   public:
+      // number of observations in row d of mode, i.e. the work for sampling that row
+      virtual std::uint64_t row_nnz(uint32_t mode, int d) const;
+
+      void setDegreeSchedule(bool value) { m_use_degree_schedule = value; }
+      bool getDegreeSchedule() const { return m_use_degree_schedule; }
+
+      // order in which to sample the rows of mode, empty when the natural order is used
+      const std::vector<int> &getSampleOrder(uint32_t mode) const;
+
+      // called after row d in mode has been sampled
+      virtual void update_residuals(const SubModel& model, uint32_t mode, int d);
+
    public:
       INoiseModel &noise() const;
       void setNoiseModel(std::unique_ptr<INoiseModel> &&nm);
@@ -84,8 +130,8 @@ namespace smurff
 
    /// ### create
    public:
-      static std::shared_ptr<Data> create(const std::vector<DataConfig> &dc); // multiple
+      static std::shared_ptr<Data> create(const Config &config); // all train data in config
    private:
-      static std::shared_ptr<Data> create(const DataConfig &dc); // single matrix/tensor
+      static std::shared_ptr<Data> create(const DataConfig &dc, const Config &config); // single matrix/tensor
    };
 }
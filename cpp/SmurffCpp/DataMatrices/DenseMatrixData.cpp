@@ -1,5 +1,7 @@
 #include "DenseMatrixData.h"
 
+#include <numeric>
+
 namespace smurff {
 
 DenseMatrixData::DenseMatrixData(Matrix Y)
@@ -9,9 +11,10 @@ DenseMatrixData::DenseMatrixData(Matrix Y)
 }
 
 //d is an index of column in U matrix
-void DenseMatrixData::getMuLambda(const SubModel& model, uint32_t mode, int d, Vector& rr, Matrix& MM) const
+void DenseMatrixData::getMu(const SubModel& model, uint32_t mode, int d, Vector& rr) const
 {
-    auto &Y = this->Y(mode).row(d);
+    const auto Yv = this->Y(mode);
+    const auto Y = Yv.row(d);
     auto Vf = *model.CVbegin(mode);
     auto &ns = noise();
 
@@ -22,8 +25,6 @@ void DenseMatrixData::getMuLambda(const SubModel& model, uint32_t mode, int d, V
         double noisy_val = ns.sample(model, pos, Y(r));
         rr.noalias() += row * noisy_val; // rr = rr + (V[m] * noisy_y[d]) 
     }
-
-    MM.noalias() += ns.getAlpha() * VV[mode]; // MM = MM + VV[m]
 }
 
 double DenseMatrixData::train_rmse(const SubModel& model) const
@@ -51,12 +52,19 @@ double DenseMatrixData::sumsq(const SubModel& model) const
 {
    double sumsq = 0.0;
 
+   std::vector<int> cols(this->ncol());
+   std::iota(cols.begin(), cols.end(), 0);
+
    #pragma omp parallel for schedule(guided) reduction(+:sumsq)
-   for (int j = 0; j < this->ncol(); j++) 
+   for (int i = 0; i < this->nrow(); i++) 
    {
-      for (int i = 0; i < this->nrow(); i++) 
+      double pred[Model::PREDICT_BATCH];
+      for (int start = 0; start < this->ncol(); start += Model::PREDICT_BATCH)
       {
-         sumsq += std::pow(model.predict({i,j}) - this->Y()(i,j), 2);
+         const int n = std::min(Model::PREDICT_BATCH, this->ncol() - start);
+         model.predict(0, i, cols.data() + start, n, pred);
+         for (int j = 0; j < n; j++) 
+            sumsq += std::pow(pred[j] - this->Y()(i, start + j), 2);
       }
    }
 
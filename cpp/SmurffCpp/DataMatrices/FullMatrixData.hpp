@@ -6,6 +6,7 @@
 #include <SmurffCpp/ConstVMatrixExprIterator.hpp>
 
 #include <SmurffCpp/Utils/ThreadVector.hpp>
+#include <SmurffCpp/Utils/FixedKernels.hpp>
 
 namespace smurff
 {
@@ -22,6 +23,12 @@ namespace smurff
          this->name = "MatrixData [fully known]";
       }
 
+      FullMatrixData(const MappedSparseMatrix &Y)
+         : MatrixDataTempl<YType>(Y)
+      {
+         this->name = "MatrixData [fully known]";
+      }
+
    public:
       //purpose of update_pnm is to cache VV matrix
       void update_pnm(const SubModel& model, uint32_t mode) override
@@ -31,16 +38,37 @@ namespace smurff
          thread_vector<Matrix> VVs(Matrix::Zero(nl, nl));
 
          //for each column v of Vf - calculate v * vT and add to VVs
-         #pragma omp parallel for schedule(guided) shared(VVs)
-         for(int n = 0; n < Vf.rows(); n++) 
-         {
-            auto v = Vf.row(n);
-            VVs.local() += v.transpose() * v; // VVs = Vvs + vT * v
-         }
+         kernels::dispatch(nl, [&Vf, &VVs, nl](auto k) {
+            constexpr int K = decltype(k)::value;
+
+            #pragma omp parallel for schedule(guided) shared(VVs)
+            for(int n = 0; n < Vf.rows(); n++) 
+            {
+               auto v = Vf.row(n).template head<K>(nl);
+               VVs.local().template topLeftCorner<K, K>(nl, nl).noalias() += v.transpose() * v; // VVs = Vvs + vT * v
+            }
+         });
 
          VV[mode] = VVs.combine(); //accumulate sum
       }
 
+      // all rows see the same (fully known) V, hence the same precision
+      bool hasSharedPrecision(uint32_t mode) const override
+      {
+         return true;
+      }
+
+      void getSharedLambda(const SubModel& model, uint32_t mode, Matrix& MM) const override
+      {
+         MM.noalias() += this->noise().getAlpha() * VV[mode]; // MM = MM + VV[m]
+      }
+
+      void getMuLambda(const SubModel& model, uint32_t mode, int d, Vector& rr, Matrix& MM) const override
+      {
+         this->getMu(model, mode, d, rr);
+         getSharedLambda(model, mode, MM);
+      }
+
       std::uint64_t nna() const override
       {
          return 0;
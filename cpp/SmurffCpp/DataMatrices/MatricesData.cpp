@@ -120,6 +120,52 @@ void MatricesData::getMuLambda(const SubModel& model, uint32_t mode, int pos, Ve
    THROWERROR_ASSERT(count > 0);
 }
 
+void MatricesData::update_residuals(const SubModel& model, uint32_t mode, int pos)
+{
+   apply(mode, pos, [&model, mode, pos](const Block &b) {
+       b.data()->update_residuals(b.submodel(model), mode, pos - b.start(mode));
+   });
+}
+
+std::uint64_t MatricesData::row_nnz(uint32_t mode, int pos) const
+{
+   std::uint64_t ret = 0;
+   apply(mode, pos, [mode, pos, &ret](const Block &b) {
+       ret += b.data()->row_nnz(mode, pos - b.start(mode));
+   });
+   return ret;
+}
+
+// shared only if every block spans the full mode
+bool MatricesData::hasSharedPrecision(uint32_t mode) const
+{
+   if (nview(mode) != 1)
+      return false;
+
+   for(auto &b : blocks)
+      if (!b.data()->hasSharedPrecision(mode))
+         return false;
+
+   return true;
+}
+
+void MatricesData::getSharedLambda(const SubModel& model, uint32_t mode, Matrix& MM) const
+{
+   for(auto &b : blocks)
+      b.data()->getSharedLambda(b.submodel(model), mode, MM);
+}
+
+void MatricesData::getMu(const SubModel& model, uint32_t mode, int pos, Vector& rr) const
+{
+   int count = 0;
+   apply(mode, pos, [&model, mode, pos, &rr, &count](const Block &b) {
+       b.data()->getMu(b.submodel(model), mode, pos - b.start(mode), rr);
+       count++;
+   });
+
+   THROWERROR_ASSERT(count > 0);
+}
+
 void MatricesData::update_pnm(const SubModel& model, uint32_t mode)
 {
    for(auto &b : blocks) {
@@ -26,6 +26,12 @@ namespace smurff
       void update(const SubModel& model) override;
       void getMuLambda(const SubModel& model, uint32_t mode, int d, Vector& rr, Matrix& MM) const override;
       void update_pnm(const SubModel& model, uint32_t mode) override;
+      void update_residuals(const SubModel& model, uint32_t mode, int d) override;
+      std::uint64_t row_nnz(uint32_t mode, int d) const override;
+
+      bool hasSharedPrecision(uint32_t mode) const override;
+      void getSharedLambda(const SubModel& model, uint32_t mode, Matrix& MM) const override;
+      void getMu(const SubModel& model, uint32_t mode, int d, Vector& rr) const override;
 
       //-- print info
       std::ostream& info(std::ostream& os, std::string indent) override;
@@ -3,6 +3,7 @@
 #include <memory>
 
 #include "MatrixData.h"
+#include "MatrixModes.hpp"
 
 #include <SmurffCpp/Utils/Error.h>
 
@@ -12,19 +13,26 @@ namespace smurff
    class MatrixDataTempl : public MatrixData
    {
    private:
-      // matrices with the data
-      std::vector<YType> m_Yv;
+      // the data, and the rows of Y^T sharing the values of Y unless m_transposed_values
+      MatrixModes<YType> m_modes;
+      bool m_transposed_values = false;
 
    public:
-      MatrixDataTempl(YType Y)
+      MatrixDataTempl(const YType &Y)
+         : m_modes(Y)
+      {
+      }
+
+      // sparse data mapped from a file, see HDF5Group::map
+      MatrixDataTempl(const MappedSparseMatrix &Y)
+         : m_modes(Y)
       {
-         m_Yv.push_back(Y);
-         m_Yv.push_back(Y.transpose());
       }
 
       void init_pre() override
       {
          THROWERROR_ASSERT(nrow() > 0 && ncol() > 0);
+         m_modes.init(m_transposed_values);
       }
 
       PVec<> dim() const override 
@@ -42,10 +50,28 @@ namespace smurff
          return Y().sum(); 
       }
 
+      std::ostream& info(std::ostream& os, std::string indent) override
+      {
+         MatrixData::info(os, indent);
+         return m_modes.info(os, indent);
+      }
+
    public:
-      const YType& Y(int mode = 0) const
+      // keep a copy of the values in column order: faster sampling of the columns,
+      // at the cost of memory (takes effect at init)
+      void setTransposedValues(bool value) { m_transposed_values = value; }
+      bool getTransposedValues() const { return m_transposed_values; }
+
+   public:
+      const typename MatrixModes<YType>::YMatrix& Y() const
+      {
+         return m_modes.Y();
+      }
+
+      // rows of Y (mode 0) or of Y^T (mode 1)
+      typename MatrixModes<YType>::View Y(int mode) const
       {
-         return m_Yv.at(mode);
+         return m_modes.view(mode);
       }
    };
 }
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <ostream>
+#include <cstdint>
+
+#include <SmurffCpp/Types.h>
+#include <SmurffCpp/Utils/Error.h>
+#include <SmurffCpp/Utils/MatrixUtils.h>
+#include <SmurffCpp/Utils/MappedFile.h>
+
+namespace smurff
+{
+   // Rows of one mode of a compressed sparse matrix: the rows of Y for mode 0,
+   // the columns of Y for mode 1.
+   //
+   // Element i (begin(n) <= i < end(n)) of row n has column index(i) and value(i).
+   // When perm is set, the values are read through it from the values of Y,
+   // so both modes share one values array.
+   class SparseModeView
+   {
+   public:
+      typedef SparseMatrix::StorageIndex Index;
+
+   private:
+      Index m_rows;
+      Index m_nnz;
+      const Index *m_outer;
+      const Index *m_inner;
+      const float_type *m_values;
+      const Index *m_perm;
+
+   public:
+      SparseModeView(Index rows, Index nnz, const Index *outer, const Index *inner, const float_type *values, const Index *perm = nullptr)
+         : m_rows(rows), m_nnz(nnz), m_outer(outer), m_inner(inner), m_values(values), m_perm(perm)
+      {
+      }
+
+      Index rows() const { return m_rows; }
+      Index nonZeros() const { return m_nnz; }
+
+      Index begin(int n) const { return m_outer[n]; }
+      Index end(int n) const { return m_outer[n + 1]; }
+      Index nnz(int n) const { return end(n) - begin(n); }
+
+      Index index(Index i) const { return m_inner[i]; }
+      const Index *indexPtr(Index i) const { return m_inner + i; }
+      float_type value(Index i) const { return m_perm ? m_values[m_perm[i]] : m_values[i]; }
+
+      // same interface as SparseMatrix::InnerIterator, valid after the view is gone
+      class InnerIterator
+      {
+      private:
+         const Index *m_inner;
+         const float_type *m_values;
+         const Index *m_perm;
+         Index m_pos;
+         const Index m_end;
+
+      public:
+         InnerIterator(const SparseModeView &view, int n)
+            : m_inner(view.m_inner), m_values(view.m_values), m_perm(view.m_perm), m_pos(view.begin(n)), m_end(view.end(n))
+         {
+         }
+
+         InnerIterator &operator++() { ++m_pos; return *this; }
+         operator bool() const { return m_pos < m_end; }
+
+         Index pos() const { return m_pos; }
+         Index col() const { return m_inner[m_pos]; }
+         float_type value() const { return m_perm ? m_values[m_perm[m_pos]] : m_values[m_pos]; }
+      };
+   };
+
+   // Data of a matrix and access to the rows of both its modes, without keeping a copy of Y^T.
+   template<typename YType>
+   class MatrixModes;
+
+   // Y is row-major: the rows of Y^T are the strided columns of Y
+   template<>
+   class MatrixModes<Matrix>
+   {
+   public:
+      typedef Matrix YMatrix;
+      typedef Eigen::Map<const Matrix, 0, Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>> View;
+
+   private:
+      Matrix m_Y;
+
+   public:
+      MatrixModes(const Matrix &Y)
+         : m_Y(Y)
+      {
+      }
+
+      MatrixModes(const MatrixModes &) = delete;
+
+      void init(bool)
+      {
+      }
+
+      const Matrix &Y() const
+      {
+         return m_Y;
+      }
+
+      View view(int mode) const
+      {
+         typedef Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic> Stride;
+
+         if (mode == 0)
+            return View(m_Y.data(), m_Y.rows(), m_Y.cols(), Stride(m_Y.cols(), 1));
+
+         THROWERROR_ASSERT(mode == 1);
+         return View(m_Y.data(), m_Y.cols(), m_Y.rows(), Stride(1, m_Y.cols()));
+      }
+
+      std::ostream& info(std::ostream& os, std::string indent) const
+      {
+         return os;
+      }
+   };
+
+   // Y is CSR, in memory or mapped from a file: mode 1 uses the CSC index structure of Y
+   // and, per element, either the position of its value in Y (default) or a copy of the value
+   template<>
+   class MatrixModes<SparseMatrix>
+   {
+   public:
+      typedef SparseMatrixMap YMatrix;
+      typedef SparseModeView View;
+      typedef View::Index Index;
+
+   private:
+      SparseMatrix m_Y; // empty when mapped
+      MappedSparseMatrix m_mapped; // mapped Y and its transposed index, if any
+      SparseMatrixMap m_map; // Y, in m_Y or in m_mapped
+
+      // transposed index built by init, unless the mapped one is used
+      std::vector<Index> m_outer;
+      std::vector<Index> m_inner;
+      std::vector<Index> m_perm; // position of the value in Y, empty if m_values is used
+      std::vector<float_type> m_values; // copy of the values in column order, only when asked for
+
+      static SparseMatrix compressed(SparseMatrix Y)
+      {
+         Y.makeCompressed();
+         return Y;
+      }
+
+   public:
+      MatrixModes(const SparseMatrix &Y)
+         : m_Y(compressed(Y)),
+           m_map(m_Y.rows(), m_Y.cols(), m_Y.nonZeros(), m_Y.outerIndexPtr(), m_Y.innerIndexPtr(), m_Y.valuePtr())
+      {
+      }
+
+      MatrixModes(const MappedSparseMatrix &Y)
+         : m_mapped(Y),
+           m_map(Y.rows, Y.cols, Y.nnz, Y.outer, Y.inner, Y.values)
+      {
+      }
+
+      MatrixModes(const MatrixModes &) = delete;
+
+      void init(bool transposed_values)
+      {
+         m_outer.clear();
+         m_inner.clear();
+         m_perm.clear();
+         m_values.clear();
+
+         // mapped transposed index is used as is
+         if (m_mapped.file && !transposed_values)
+            return;
+
+         matrix_utils::transposed_index(m_map, m_outer, m_inner, m_perm);
+
+         if (transposed_values)
+         {
+            m_values.resize(m_perm.size());
+            for (std::size_t p = 0; p < m_perm.size(); ++p)
+               m_values[p] = m_map.valuePtr()[m_perm[p]];
+            std::vector<Index>().swap(m_perm);
+         }
+      }
+
+      const SparseMatrixMap &Y() const
+      {
+         return m_map;
+      }
+
+      View view(int mode) const
+      {
+         if (mode == 0)
+            return View(m_map.rows(), m_map.nonZeros(), m_map.outerIndexPtr(), m_map.innerIndexPtr(), m_map.valuePtr());
+
+         THROWERROR_ASSERT(mode == 1);
+
+         if (m_values.size())
+            return View(m_map.cols(), m_map.nonZeros(), m_outer.data(), m_inner.data(), m_values.data());
+
+         if (m_outer.size())
+            return View(m_map.cols(), m_map.nonZeros(), m_outer.data(), m_inner.data(), m_map.valuePtr(), m_perm.data());
+
+         THROWERROR_ASSERT_MSG(m_mapped.file, "MatrixModes not initialized");
+         return View(m_map.cols(), m_map.nonZeros(), m_mapped.t_outer, m_mapped.t_inner, m_map.valuePtr(), m_mapped.t_perm);
+      }
+
+      std::ostream& info(std::ostream& os, std::string indent) const
+      {
+         if (m_mapped.file)
+            os << indent << "Mapped from: " << m_mapped.file->getPath() << "\n";
+
+         const std::uint64_t bytes = (m_outer.size() + m_inner.size() + m_perm.size()) * sizeof(Index)
+                                   + m_values.size() * sizeof(float_type);
+         if (bytes)
+            os << indent << "Transposed view: " << bytes << " bytes" << (m_values.size() ? " (copy of values)" : " (values shared with Y)") << "\n";
+
+         return os;
+      }
+   };
+}
@@ -4,15 +4,25 @@
 #include <SmurffCpp/ConstVMatrixExprIterator.hpp>
 
 #include <SmurffCpp/Utils/ThreadVector.hpp>
+#include <SmurffCpp/Utils/FixedKernels.hpp>
 
 namespace smurff {
 
+// max number of V rows gathered in one tile
+static const int GATHER_TILE_SIZE = 256;
+
 ScarceMatrixData::ScarceMatrixData(SparseMatrix Y)
    : MatrixDataTempl<SparseMatrix >(Y)
 {
    name = "ScarceMatrixData [with NAs]";
 }
 
+ScarceMatrixData::ScarceMatrixData(const MappedSparseMatrix &Y)
+   : MatrixDataTempl<SparseMatrix >(Y)
+{
+   name = "ScarceMatrixData [with NAs]";
+}
+
 void ScarceMatrixData::init_pre()
 {
    MatrixDataTempl<SparseMatrix >::init_pre();
@@ -20,14 +30,19 @@ void ScarceMatrixData::init_pre()
    // check no rows, nor cols withouth data
    for(std::uint64_t mode = 0; mode < nmode(); ++mode)
    {
-      auto& m = this->Y(mode);
+      const auto m = this->Y(mode);
       auto& count = num_empty[mode];
       for (int j = 0; j < m.rows(); j++)
       {
-         if (m.row(j).nonZeros() == 0) 
+         if (m.nnz(j) == 0) 
             count++;
       }
    }
+
+   m_tiles.init();
+   m_tile_vals.init();
+   m_rrs.init();
+   m_MMs.init();
 }
 
 double ScarceMatrixData::train_rmse(const SubModel& model) const 
@@ -45,35 +60,89 @@ std::ostream& ScarceMatrixData::info(std::ostream& os, std::string indent)
 
 void ScarceMatrixData::getMuLambda(const SubModel& model, std::uint32_t mode, int n, Vector& rr, Matrix& MM) const
 {
-   auto &Y = this->Y(mode);
+   const auto Y = this->Y(mode);
    const int num_latent = model.nlatent();
-   const std::int64_t local_nnz = Y.row(n).nonZeros();
+   const std::int64_t local_nnz = Y.nnz(n);
    const std::int64_t total_nnz = Y.nonZeros();
-   auto from = Y.outerIndexPtr()[n];
-   auto to = Y.outerIndexPtr()[n+1];
+   auto from = Y.begin(n);
+   auto to = Y.end(n);
 
-   auto getMuLambdaBasic = [&model, this, mode, n](int from, int to, Vector& rr, Matrix& MM) -> void
+   auto getMuLambdaBasic = [&model, this, mode, n, num_latent](int from, int to, Vector& rr, Matrix& MM) -> void
    {
-       auto &Y = this->Y(mode);
+       const auto Y = this->Y(mode);
        auto Vf = *model.CVbegin(mode);
        auto &ns = noise();
 
-       for(int i = from; i < to; ++i)
-       {
-           auto val = Y.valuePtr()[i];
-           auto idx = Y.innerIndexPtr()[i];
-           const auto &row = Vf.row(idx);
-           auto pos = this->pos(mode, n, idx);
-           double noisy_val = ns.sample(model, pos, val);
-           rr.noalias() += row * noisy_val;
-           MM.triangularView<Eigen::Lower>() +=  ns.getAlpha() * row.transpose() * row;
-       }
+       kernels::dispatch(num_latent, [&](auto k) {
+           constexpr int K = decltype(k)::value;
+           auto rrK = rr.template head<K>(num_latent);
+           auto MMK = MM.template topLeftCorner<K, K>(num_latent, num_latent);
+
+           for(int i = from; i < to; ++i)
+           {
+               auto val = Y.value(i);
+               auto idx = Y.index(i);
+               const auto &row = Vf.row(idx).template head<K>(num_latent);
+               auto pos = this->pos(mode, n, idx);
+               double noisy_val = ns.sample(model, pos, val);
+               rrK.noalias() += row * noisy_val;
+               MMK.template triangularView<Eigen::Lower>() +=  ns.getAlpha() * row.transpose() * row;
+           }
+       });
 
        // make MM complete
        MM.triangularView<Eigen::Upper>() = MM.transpose();
     };
 
-   
+   // same as getMuLambdaBasic, but gathers the rows of V and the noisy values
+   // in a contiguous tile, then does one SYRK and one GEMV per tile
+   auto getMuLambdaGather = [&model, this, mode, n, num_latent](int from, int to, Vector& rr, Matrix& MM) -> void
+   {
+       const auto Y = this->Y(mode);
+       auto Vf = *model.CVbegin(mode);
+       auto &ns = noise();
+       Matrix &tile = m_tiles.local();
+       Vector &vals = m_tile_vals.local();
+
+       // full-size tiles, only the first size rows are used: no reallocation for the last tile
+       tile.resize(GATHER_TILE_SIZE, num_latent);
+       vals.resize(GATHER_TILE_SIZE);
+
+       kernels::dispatch(num_latent, [&](auto k) {
+           constexpr int K = decltype(k)::value;
+           auto rrK = rr.template head<K>(num_latent);
+           auto MMK = MM.template topLeftCorner<K, K>(num_latent, num_latent);
+
+           for(int start = from; start < to; start += GATHER_TILE_SIZE)
+           {
+               const int size = std::min(GATHER_TILE_SIZE, to - start);
+               auto tile_rows = tile.topRows(size).template leftCols<K>(num_latent);
+               auto tile_vals = vals.head(size);
+
+               for(int i = 0; i < size; ++i)
+               {
+                   tile_rows.row(i) = Vf.row(Y.index(start + i)).template head<K>(num_latent);
+                   tile_vals(i) = Y.value(start + i);
+               }
+               ns.sample(model, mode, n, Y.indexPtr(start), tile_vals.data(), size);
+
+               rrK.noalias() += tile_vals * tile_rows;
+               MMK.template selfadjointView<Eigen::Lower>().rankUpdate(tile_rows.transpose(), ns.getAlpha());
+           }
+       });
+
+       // make MM complete
+       MM.triangularView<Eigen::Upper>() = MM.transpose();
+   };
+
+   auto getMuLambdaKernel = [this, &getMuLambdaBasic, &getMuLambdaGather](int from, int to, Vector& rr, Matrix& MM) -> void
+   {
+       if (m_gather_kernel)
+          getMuLambdaGather(from, to, rr, MM);
+       else
+          getMuLambdaBasic(from, to, rr, MM);
+   };
+
 
    bool in_parallel = (local_nnz >10000) || ((double)local_nnz > (double)total_nnz / 100.);
    if (in_parallel) 
@@ -85,7 +154,7 @@ void ScarceMatrixData::getMuLambda(const SubModel& model, std::uint32_t mode, in
        for(int j = from; j < to; j += task_size) 
        {
            #pragma omp task shared(rrs, MMs)
-           getMuLambdaBasic(j, std::min(j + task_size, to), rrs.local(), MMs.local());
+           getMuLambdaKernel(j, std::min(j + task_size, to), rrs.local(), MMs.local());
        }
        #pragma omp taskwait
        
@@ -95,10 +164,12 @@ void ScarceMatrixData::getMuLambda(const SubModel& model, std::uint32_t mode, in
    } 
    else 
    {
-      Vector my_rr = Vector::Zero(num_latent);
-      Matrix my_MM = Matrix::Zero(num_latent, num_latent);
+      Vector &my_rr = m_rrs.local();
+      Matrix &my_MM = m_MMs.local();
+      my_rr.setZero(num_latent);
+      my_MM.setZero(num_latent, num_latent);
 
-      getMuLambdaBasic(from, to, my_rr, my_MM);
+      getMuLambdaKernel(from, to, my_rr, my_MM);
 
       // add to global
       rr += my_rr;
@@ -106,9 +177,60 @@ void ScarceMatrixData::getMuLambda(const SubModel& model, std::uint32_t mode, in
    }
 }
 
+bool ScarceMatrixData::getMuLowRank(const SubModel& model, std::uint32_t mode, int n, int max_rank, Vector& rr, Matrix& Vd, int& rank) const
+{
+   const auto Y = this->Y(mode);
+   const int local_nnz = Y.nnz(n);
+   if (local_nnz >= max_rank)
+      return false;
+
+   auto Vf = *model.CVbegin(mode);
+   auto &ns = noise();
+   const double sqrt_alpha = std::sqrt(ns.getAlpha());
+
+   THROWERROR_ASSERT(Vd.rows() >= max_rank && Vd.cols() == model.nlatent());
+   rank = local_nnz;
+
+   int i = 0;
+   for (SparseModeView::InnerIterator it(Y, n); it; ++it, ++i)
+   {
+      const auto &row = Vf.row(it.col());
+      auto pos = this->pos(mode, n, it.col());
+      double noisy_val = ns.sample(model, pos, it.value());
+      rr.noalias() += row * noisy_val;
+      Vd.row(i) = sqrt_alpha * row;
+   }
+
+   return true;
+}
+
 void ScarceMatrixData::update_pnm(const SubModel &, std::uint32_t mode)
 {
    //can not cache VV because of scarceness
+
+   // residuals will be complete after sampling the last mode
+   m_residuals_valid = m_residuals.size() && mode == nmode() - 1;
+}
+
+void ScarceMatrixData::update_residuals(const SubModel& model, std::uint32_t mode, int n)
+{
+   if (!m_residuals_valid || mode != nmode() - 1)
+      return;
+
+   const auto Y = this->Y(mode);
+   double pred[Model::PREDICT_BATCH];
+   for(int start = Y.begin(n); start < Y.end(n); start += Model::PREDICT_BATCH)
+   {
+      const int size = std::min(Model::PREDICT_BATCH, Y.end(n) - start);
+      model.predict(mode, n, Y.indexPtr(start), size, pred);
+      for(int i = 0; i < size; ++i)
+         m_residuals(start + i) = pred[i] - Y.value(start + i);
+   }
+}
+
+std::uint64_t ScarceMatrixData::row_nnz(std::uint32_t mode, int n) const
+{
+   return this->Y(mode).nnz(n);
 }
 
 std::uint64_t ScarceMatrixData::nna() const
@@ -124,7 +246,7 @@ double ScarceMatrixData::var_total() const
    #pragma omp parallel for schedule(guided) reduction(+:se)
    for (int k = 0; k < Y().outerSize(); ++k)
    {
-      for (SparseMatrix::InnerIterator it(Y(), k); it; ++it)
+      for (SparseMatrixMap::InnerIterator it(Y(), k); it; ++it)
       {
          se += std::pow(it.value() - cwise_mean, 2);
       }
@@ -142,14 +264,24 @@ double ScarceMatrixData::var_total() const
 
 double ScarceMatrixData::sumsq(const SubModel& model) const
 {
+   if (m_residuals_valid)
+      return sumsq_residuals();
+
    double sumsq = 0.0;
 
    #pragma omp parallel for schedule(guided) reduction(+:sumsq)
    for (int j = 0; j < Y().outerSize(); j++) 
    {
-      for (SparseMatrix::InnerIterator it(Y(), j); it; ++it) 
+      const int begin = Y().outerIndexPtr()[j];
+      const int end = Y().outerIndexPtr()[j + 1];
+      double pred[Model::PREDICT_BATCH];
+
+      for (int start = begin; start < end; start += Model::PREDICT_BATCH) 
       {
-         sumsq += std::pow(model.predict({static_cast<int>(it.row()), static_cast<int>(it.col())})- it.value(), 2);
+         const int n = std::min(Model::PREDICT_BATCH, end - start);
+         model.predict(0, j, Y().innerIndexPtr() + start, n, pred);
+         for (int i = 0; i < n; ++i)
+            sumsq += std::pow(pred[i] - Y().valuePtr()[start + i], 2);
       }
    }
 
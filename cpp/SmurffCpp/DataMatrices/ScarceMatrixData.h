@@ -2,6 +2,8 @@
 
 #include "MatrixDataTempl.hpp"
 
+#include <SmurffCpp/Utils/ThreadVector.hpp>
+
 namespace smurff
 {
    class ScarceMatrixData : public MatrixDataTempl<SparseMatrix >
@@ -9,8 +11,21 @@ namespace smurff
    private:
       int num_empty[2] = {0,0};
 
+      // gather rows of V into a tile and use SYRK/GEMV in getMuLambda
+      bool m_gather_kernel = true;
+      mutable thread_vector<Matrix> m_tiles;
+      mutable thread_vector<Vector> m_tile_vals;
+
+      // per-row accumulators of getMuLambda when not run in parallel
+      mutable thread_vector<Vector> m_rrs;
+      mutable thread_vector<Matrix> m_MMs;
+
    public:
       ScarceMatrixData(SparseMatrix Y);
+      ScarceMatrixData(const MappedSparseMatrix &Y);
+
+      void setGatherKernel(bool value) { m_gather_kernel = value; }
+      bool getGatherKernel() const { return m_gather_kernel; }
 
    public:
       void init_pre() override;
@@ -20,7 +35,10 @@ namespace smurff
       std::ostream& info(std::ostream& os, std::string indent) override;
 
       void getMuLambda(const SubModel& model, std::uint32_t mode, int d, Vector& rr, Matrix& MM) const override;
+      bool getMuLowRank(const SubModel& model, std::uint32_t mode, int d, int max_rank, Vector& rr, Matrix& Vd, int& rank) const override;
       void update_pnm(const SubModel& model, std::uint32_t mode) override;
+      void update_residuals(const SubModel& model, std::uint32_t mode, int d) override;
+      std::uint64_t row_nnz(std::uint32_t mode, int d) const override;
 
       std::uint64_t nna() const override;
 
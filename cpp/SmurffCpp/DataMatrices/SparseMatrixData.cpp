@@ -8,21 +8,25 @@ SparseMatrixData::SparseMatrixData(SparseMatrix Y)
    this->name = "SparseMatrixData [fully known]";
 }
 
-void SparseMatrixData::getMuLambda(const SubModel& model, uint32_t mode, int d, Vector& rr, Matrix& MM) const
+SparseMatrixData::SparseMatrixData(const MappedSparseMatrix &Y)
+   : FullMatrixData<SparseMatrix>(Y)
+{
+   this->name = "SparseMatrixData [fully known]";
+}
+
+void SparseMatrixData::getMu(const SubModel& model, uint32_t mode, int d, Vector& rr) const
 {
-    const auto& Y = this->Y(mode);
+    const auto Y = this->Y(mode);
     auto Vf = *model.CVbegin(mode);
     auto &ns = noise();
 
-    for (SparseMatrix::InnerIterator it(Y, d); it; ++it) 
+    for (SparseModeView::InnerIterator it(Y, d); it; ++it) 
     {
         const auto &row = Vf.row(it.col());
         auto p = pos(mode, d, it.col());
         double noisy_val = ns.sample(model, p, it.value());
         rr.noalias() += row * noisy_val; // rr = rr + (V[m] * y[d]) * alpha
     }
-
-    MM.noalias() += ns.getAlpha() * VV[mode]; // MM = MM + VV[m]
 }
 
 double SparseMatrixData::train_rmse(const SubModel& model) const
@@ -40,7 +44,7 @@ double SparseMatrixData::var_total() const
    for(int c = 0; c < Y().outerSize(); ++c)
    {
       int r = 0;
-      for (SparseMatrix::InnerIterator it(Y(), c); it; ++it)
+      for (SparseMatrixMap::InnerIterator it(Y(), c); it; ++it)
       {
          se += (r - it.row()) * cwise_mean_squared; // handle implicit zeroes
          se += std::pow(it.value() - cwise_mean, 2);
@@ -60,27 +64,33 @@ double SparseMatrixData::var_total() const
    return var;
 }
 
+// sum over all cells, implicit zeroes included:
+//   sum(pred^2) + sum_nnz((pred - y)^2 - pred^2)
+// where sum(pred^2) = trace(U^T U * V^T V)
 double SparseMatrixData::sumsq(const SubModel& model) const
 {
-   double sumsq = 0.0;
-   
+   const Matrix UtU = model.U(0).transpose() * model.U(0);
+   const Matrix VtV = model.U(1).transpose() * model.U(1);
+   double sumsq = (UtU.array() * VtV.array()).sum(); // both symmetric
+
    THROWERROR_ASSERT(Y().IsRowMajor);
    #pragma omp parallel for schedule(guided) reduction(+:sumsq)
    for(int r = 0; r < Y().outerSize(); ++r) // rows
    {
-      int c = 0;
-      for (SparseMatrix::InnerIterator it(Y(), r); it; ++it) // cols
-      {
-         for(; c < it.col(); c++) //handle implicit zeroes
-            sumsq += std::pow(model.predict({r, c}), 2);
+      const int begin = Y().outerIndexPtr()[r];
+      const int end = Y().outerIndexPtr()[r + 1];
+      double pred[Model::PREDICT_BATCH];
 
-         // actual non-zero
-         sumsq += std::pow(model.predict({r, c}) - it.value(), 2);
-         c++;
+      for (int start = begin; start < end; start += Model::PREDICT_BATCH) // non-zero cols
+      {
+         const int n = std::min(Model::PREDICT_BATCH, end - start);
+         model.predict(0, r, Y().innerIndexPtr() + start, n, pred);
+         for (int j = 0; j < n; ++j)
+         {
+            const double y = Y().valuePtr()[start + j];
+            sumsq += y * (y - 2 * pred[j]);
+         }
       }
-
-      for(; c < Y().cols(); c++) //handle implicit zeroes
-         sumsq += std::pow(model.predict({r, c}), 2);
    }
 
    return sumsq;
@@ -8,8 +8,9 @@ namespace smurff
    {
    public:
       SparseMatrixData(SparseMatrix Y);
+      SparseMatrixData(const MappedSparseMatrix &Y);
 
-      void getMuLambda(const SubModel& model, std::uint32_t mode, int d, Vector& rr, Matrix& MM) const override;
+      void getMu(const SubModel& model, std::uint32_t mode, int d, Vector& rr) const override;
 
    public:
       double train_rmse(const SubModel& model) const override;
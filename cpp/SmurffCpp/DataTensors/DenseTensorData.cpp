@@ -0,0 +1,205 @@
+#include "DenseTensorData.h"
+
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <numeric>
+#include <functional>
+
+#include <SmurffCpp/ConstVMatrixExprIterator.hpp>
+#include <SmurffCpp/Utils/Error.h>
+
+namespace smurff {
+
+DenseTensorData::DenseTensorData(const DenseTensor& ts)
+   : m_dims(ts.getDims()),
+     m_Y(Eigen::Map<const Eigen::Matrix<double, 1, Eigen::Dynamic>>(ts.getValues().data(), ts.getValues().size()).cast<float_type>()),
+     VV(ts.getNModes())
+{
+   this->name = "DenseTensorData [fully known]";
+}
+
+void DenseTensorData::init_pre()
+{
+   THROWERROR_ASSERT(m_dims.size() >= 2);
+   THROWERROR_ASSERT_MSG((std::uint64_t)m_Y.size() == size(), "Number of values does not match the tensor dimensions");
+}
+
+double DenseTensorData::sum() const
+{
+   return m_Y.sum();
+}
+
+std::uint64_t DenseTensorData::nmode() const
+{
+   return m_dims.size();
+}
+
+std::uint64_t DenseTensorData::nnz() const
+{
+   return m_Y.size();
+}
+
+std::uint64_t DenseTensorData::nna() const
+{
+   return 0;
+}
+
+PVec<> DenseTensorData::dim() const
+{
+   std::vector<int> pvec_dims;
+   for(auto& d : m_dims)
+      pvec_dims.push_back(static_cast<int>(d));
+   return PVec<>(pvec_dims);
+}
+
+PVec<> DenseTensorData::pos(std::uint64_t i) const
+{
+   PVec<> coords(nmode());
+   for (int m = nmode() - 1; m >= 0; --m)
+   {
+      coords[m] = i % m_dims[m];
+      i /= m_dims[m];
+   }
+   return coords;
+}
+
+double DenseTensorData::train_rmse(const SubModel& model) const
+{
+   return std::sqrt(sumsq(model) / this->nnz());
+}
+
+void DenseTensorData::update_pnm(const SubModel& model, uint32_t mode)
+{
+   const int nl = model.nlatent();
+
+   // shared precision: Hadamard product of the Gram matrices of the other modes
+   VV[mode] = Matrix::Ones(nl, nl);
+   for (auto V = model.CVbegin(mode); V != model.CVend(); ++V)
+      VV[mode].array() *= ((*V).transpose() * (*V)).array();
+
+   // Khatri-Rao product of the other V matrices, first mode varies slowest
+   Matrix KR = Matrix::Ones(1, nl);
+   for (auto V = model.CVbegin(mode); V != model.CVend(); ++V)
+   {
+      const auto &Vk = *V;
+      Matrix next(KR.rows() * Vk.rows(), nl);
+
+      #pragma omp parallel for schedule(static)
+      for (Eigen::Index j = 0; j < KR.rows(); j++)
+         next.middleRows(j * Vk.rows(), Vk.rows()) = Vk.array().rowwise() * KR.row(j).array();
+
+      std::swap(KR, next);
+   }
+
+   // noisy values: alpha * Y for Gaussian noise, sampled per element otherwise
+   const float_type *Y = m_Y.data();
+   double alpha = 1.0;
+   if (noise().isLinear())
+   {
+      alpha = noise().getAlpha();
+   }
+   else
+   {
+      m_noisy.resize(m_Y.size());
+      #pragma omp parallel for schedule(guided)
+      for (std::uint64_t i = 0; i < nnz(); i++)
+         m_noisy(i) = noise().sample(model, pos(i), m_Y(i));
+      Y = m_noisy.data();
+   }
+
+   // mode-n unfolding times Khatri-Rao product, without copying Y:
+   // Y is an [A x dims[mode] x B] tensor, with A and B the sizes before and after mode
+   const std::uint64_t A = std::accumulate(m_dims.begin(), m_dims.begin() + mode, (std::uint64_t)1, std::multiplies<std::uint64_t>());
+   const std::uint64_t B = std::accumulate(m_dims.begin() + mode + 1, m_dims.end(), (std::uint64_t)1, std::multiplies<std::uint64_t>());
+   const std::uint64_t D = m_dims[mode];
+
+   if (B == 1)
+   {
+      // last mode: Y is [A x D] row-major
+      m_RR.noalias() = Eigen::Map<const Matrix>(Y, A, D).transpose() * KR;
+   }
+   else
+   {
+      m_RR.setZero(D, nl);
+      for (std::uint64_t a = 0; a < A; a++)
+         m_RR.noalias() += Eigen::Map<const Matrix>(Y + a * D * B, D, B) * KR.middleRows(a * B, B);
+   }
+
+   m_RR *= alpha;
+}
+
+bool DenseTensorData::hasSharedPrecision(uint32_t mode) const
+{
+   return true;
+}
+
+void DenseTensorData::getSharedLambda(const SubModel& model, uint32_t mode, Matrix& MM) const
+{
+   MM.noalias() += noise().getAlpha() * VV[mode]; // MM = MM + VV[m]
+}
+
+void DenseTensorData::getMu(const SubModel& model, uint32_t mode, int d, Vector& rr) const
+{
+   THROWERROR_ASSERT(m_RR.rows() == (Eigen::Index)m_dims[mode]);
+   rr.noalias() += m_RR.row(d);
+}
+
+void DenseTensorData::getMuLambda(const SubModel& model, uint32_t mode, int d, Vector& rr, Matrix& MM) const
+{
+   getMu(model, mode, d, rr);
+   getSharedLambda(model, mode, MM);
+}
+
+double DenseTensorData::sumsq(const SubModel& model) const
+{
+   double sumsq = 0.0;
+
+   const std::uint64_t nbatches = (nnz() + Model::PREDICT_BATCH - 1) / Model::PREDICT_BATCH;
+
+   // consecutive elements differ in the last coordinate, so they share the product of the other rows
+   #pragma omp parallel for schedule(guided) reduction(+:sumsq)
+   for (std::uint64_t b = 0; b < nbatches; b++)
+   {
+      const std::uint64_t start = b * Model::PREDICT_BATCH;
+      const std::uint64_t n = std::min<std::uint64_t>(Model::PREDICT_BATCH, nnz() - start);
+      double pred[Model::PREDICT_BATCH];
+      model.predict([this, start](std::size_t k) { return pos(start + k); }, n, pred);
+      for (std::uint64_t i = 0; i < n; i++)
+         sumsq += std::pow(pred[i] - m_Y(start + i), 2);
+   }
+
+   return sumsq;
+}
+
+double DenseTensorData::var_total() const
+{
+   double cwise_mean = this->sum() / this->nnz();
+   double se = (m_Y.array() - cwise_mean).square().sum();
+
+   double var = se / this->nnz();
+   if (var <= 0.0 || std::isnan(var))
+   {
+      // if var cannot be computed using 1.0
+      var = 1.0;
+   }
+
+   return var;
+}
+
+std::ostream& DenseTensorData::info(std::ostream& os, std::string indent)
+{
+   Data::info(os, indent);
+
+   os << indent << "Size: " << nnz() << " [";
+
+   for (std::size_t i = 0; i < m_dims.size() - 1; i++)
+   {
+      os << m_dims[i] << " x ";
+   }
+
+   os << m_dims.back() << "] (100.00%)\n";
+
+   return os;
+}
+} // end namespace smurff
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+#include <SmurffCpp/Types.h>
+
+#include <SmurffCpp/DataMatrices/Data.h>
+#include <SmurffCpp/Utils/PVec.hpp>
+
+namespace smurff {
+
+// fully known tensor, values stored once in row-major order (last mode fastest)
+//
+// for the mode being sampled, update_pnm computes
+//  - the shared precision as the Hadamard product of the V^T * V of all other modes
+//  - the mean of every row as the mode-n unfolding of Y times the Khatri-Rao
+//    product of the other V matrices
+// so no per-element work is needed while sampling
+class DenseTensorData : public Data
+{
+private:
+   std::vector<std::uint64_t> m_dims; //vector of dimension sizes
+   Vector m_Y; // values, row-major
+
+   std::vector<Matrix> VV; // per mode: Hadamard product of V^T * V of the other modes
+   Matrix m_RR; // [dims[mode] x num_latent] noisy Y times Khatri-Rao product, for the mode of the last update_pnm
+   Vector m_noisy; // noisy values, only for noise models where isLinear() is false
+
+public:
+   DenseTensorData(const DenseTensor& ts);
+
+protected:
+   void init_pre() override;
+
+public:
+   double sum() const override;
+
+public:
+   std::uint64_t nmode() const override;
+   std::uint64_t nnz() const override;
+   std::uint64_t nna() const override;
+   PVec<> dim() const override;
+
+public:
+   double train_rmse(const SubModel& model) const override;
+   void update_pnm(const SubModel& model, uint32_t mode) override;
+
+   // all rows see the same (fully known) V, hence the same precision
+   bool hasSharedPrecision(uint32_t mode) const override;
+   void getSharedLambda(const SubModel& model, uint32_t mode, Matrix& MM) const override;
+   void getMu(const SubModel& model, uint32_t mode, int d, Vector& rr) const override;
+   void getMuLambda(const SubModel& model, uint32_t mode, int d, Vector& rr, Matrix& MM) const override;
+
+public:
+   double sumsq(const SubModel& model) const override;
+   double var_total() const override;
+
+public:
+   std::ostream& info(std::ostream& os, std::string indent) override;
+
+public:
+   // coordinates of the i'th value
+   PVec<> pos(std::uint64_t i) const;
+};
+
+}
@@ -1,7 +1,9 @@
 #include "SparseMode.h"
 
 #include <iostream>
+#include <algorithm>
 #include <sstream>
+#include <limits>
 
 #include <SmurffCpp/Utils/Error.h>
 
@@ -12,25 +14,23 @@ SparseMode::SparseMode()
 {
 }
 
-// idx - [nnz x nmodes] matrix of coordinates
-// vals - vector of values
-// m - index of dimension to fix
-// mode_size - size of dimension to fix
-SparseMode::SparseMode(const MatrixXui32& idx, const std::vector<double>& vals, std::uint64_t mode, std::uint64_t mode_size) 
+// sort the items in idx by their coordinate in dimension mode, then by the other coordinates
+// row_ptr - offsets of each hyperplane in order
+// order - for each position, the row of the item in idx
+static void sortByMode(const MatrixXui32& idx, std::uint64_t mode, std::uint64_t mode_size,
+                       std::vector<std::uint64_t>& row_ptr, std::vector<std::uint32_t>& order)
 {
-   if ((size_t)idx.rows() != vals.size())
+   std::uint64_t nnz  = idx.rows(); // get nnz from index matrix
+
+   if (nnz > std::numeric_limits<std::uint32_t>::max())
    {
-      THROWERROR("Number of rows in 'idx' should equal number of values in 'vals'");
+      THROWERROR("Too many non-zero values in tensor");
    }
 
-   m_row_ptr.resize(mode_size + 1); // mode_size + 1 because this vector will hold commulative sum of number of elements
-   m_values.resize(vals.size()); // resize values vector
-   m_indices.resize(idx.rows(), idx.cols() - 1); // reduce number of columns by 1 (exclude fixed dimension)
+   row_ptr.assign(mode_size + 1, 0); // mode_size + 1 because this vector will hold commulative sum of number of elements
+   order.resize(nnz);
 
-   m_mode = mode; // save dimension index that is fixed
-   std::uint64_t nnz  = idx.rows(); // get nnz from index matrix
-
-   auto rows = idx.col(m_mode); // get column with coordinates for fixed dimension
+   auto rows = idx.col(mode); // get column with coordinates for fixed dimension
    
    // compute number of non-zero entries per each element for the mode
    // (compute number of non-zero elements for each coordinate in specific dimension)
@@ -41,49 +41,141 @@ SparseMode::SparseMode(const MatrixXui32& idx, const std::vector<double>& vals,
          THROWERROR("'idx' value is larger than 'mode_size'");
       }
 
-      m_row_ptr[rows(i)]++; //count item with specific index
+      row_ptr[rows(i)]++; //count item with specific index
    }
 
    // compute commulative sum of number of elements for each coordinate in specific dimension
    for (std::uint64_t row = 0, cumsum = 0; row < mode_size; row++)
    {
-      std::uint64_t temp = m_row_ptr[row];
-      m_row_ptr[row] = cumsum;
+      std::uint64_t temp = row_ptr[row];
+      row_ptr[row] = cumsum;
       cumsum += temp;
    }
-   m_row_ptr[mode_size] = nnz; //last element should be equal to nnz
+   row_ptr[mode_size] = nnz; //last element should be equal to nnz
 
-   // transform index matrix into index matrix with one reduced/fixed dimension
+   // place each item at the next free position of its hyperplane
    for (std::uint64_t i = 0; i < nnz; i++) 
    {
       std::uint32_t row  = rows(i); // coordinate in fixed dimension
-      std::uint64_t dest = m_row_ptr[row]; // commulative number of elements for this index
+      order[row_ptr[row]++] = i; //update commulative sum vector
+   }
 
-      for (std::uint64_t j = 0, nj = 0; j < (std::uint64_t)idx.cols(); j++) //go through each column in index matrix
+   // restore commulative row_ptr
+   for (std::uint64_t row = 0, prev = 0; row <= mode_size; row++) 
+   {
+      std::uint64_t temp = row_ptr[row];
+      row_ptr[row] = prev;
+      prev = temp;
+   }
+
+   // within each hyperplane, order items by their remaining coordinates (fiber order),
+   // so consecutive items share as many leading coordinates as possible
+   auto less = [&idx, mode](std::uint32_t a, std::uint32_t b) {
+      for (std::uint64_t m = 0; m < (std::uint64_t)idx.cols(); m++)
       {
-         if (j == m_mode) //skip fixed dimension
+         if (m == mode || idx(a, m) == idx(b, m))
             continue;
-
-         m_indices(dest, nj) = idx(i, j);
-         nj++;
+         return idx(a, m) < idx(b, m);
       }
+      return false;
+   };
+
+   #pragma omp parallel for schedule(guided)
+   for (std::uint64_t row = 0; row < mode_size; row++)
+      std::stable_sort(order.begin() + row_ptr[row], order.begin() + row_ptr[row + 1], less);
+}
 
-      m_values[dest] = vals[i];
-      m_row_ptr[row]++; //update commulative sum vector
+// copy of the items of idx and vals, in the given order
+static void storeInOrder(const MatrixXui32& idx, const std::vector<double>& vals, const std::vector<std::uint32_t>& order,
+                         std::shared_ptr<const MatrixXui32>& indices, std::shared_ptr<const std::vector<double>>& values)
+{
+   auto ordered_indices = std::make_shared<MatrixXui32>(idx.rows(), idx.cols());
+   auto ordered_values = std::make_shared<std::vector<double>>(vals.size());
+   for (std::uint64_t j = 0; j < order.size(); j++)
+   {
+      ordered_indices->row(j) = idx.row(order[j]);
+      (*ordered_values)[j] = vals[order[j]];
    }
 
-   // restore commulative row_ptr
-   for (std::uint64_t row = 0, prev = 0; row <= mode_size; row++) 
+   indices = ordered_indices;
+   values = ordered_values;
+}
+
+SparseMode::SparseMode(std::uint64_t mode,
+                       std::vector<std::uint64_t> &&row_ptr,
+                       std::vector<std::uint32_t> &&perm,
+                       std::shared_ptr<const MatrixXui32> indices,
+                       std::shared_ptr<const std::vector<double>> values)
+   : m_mode(mode), m_row_ptr(std::move(row_ptr)), m_perm(std::move(perm)), m_indices(indices), m_values(values)
+{
+}
+
+// idx - [nnz x nmodes] matrix of coordinates
+// vals - vector of values
+// m - index of dimension to fix
+// mode_size - size of dimension to fix
+SparseMode::SparseMode(const MatrixXui32& idx, const std::vector<double>& vals, std::uint64_t mode, std::uint64_t mode_size) 
+   : m_mode(mode)
+{
+   if ((size_t)idx.rows() != vals.size())
    {
-      std::uint64_t temp = m_row_ptr[row];
-      m_row_ptr[row] = prev;
-      prev = temp;
+      THROWERROR("Number of rows in 'idx' should equal number of values in 'vals'");
    }
+
+   std::vector<std::uint32_t> order;
+   sortByMode(idx, mode, mode_size, m_row_ptr, order);
+
+   // store the items in the order of this mode, no permutation needed
+   storeInOrder(idx, vals, order, m_indices, m_values);
+}
+
+std::vector<std::shared_ptr<SparseMode> > SparseMode::createAll(const MatrixXui32& idx, const std::vector<double>& vals, const std::vector<std::uint64_t>& dims)
+{
+   if ((size_t)idx.rows() != vals.size())
+   {
+      THROWERROR("Number of rows in 'idx' should equal number of values in 'vals'");
+   }
+
+   if ((size_t)idx.cols() != dims.size())
+   {
+      THROWERROR("Number of columns in 'idx' should equal number of dimensions");
+   }
+
+   std::vector<std::shared_ptr<SparseMode> > modes;
+
+   // the first mode owns the storage order
+   std::shared_ptr<const MatrixXui32> indices;
+   std::shared_ptr<const std::vector<double>> values;
+   std::vector<std::uint32_t> stored_at(idx.rows()); // position in storage of each item in idx
+   {
+      std::vector<std::uint64_t> row_ptr;
+      std::vector<std::uint32_t> order;
+      sortByMode(idx, 0, dims[0], row_ptr, order);
+      storeInOrder(idx, vals, order, indices, values);
+      for (std::uint64_t j = 0; j < order.size(); j++)
+         stored_at[order[j]] = j;
+
+      modes.push_back(std::shared_ptr<SparseMode>(new SparseMode(0, std::move(row_ptr), std::vector<std::uint32_t>(), indices, values)));
+   }
+
+   // other modes only keep a permutation into the storage of the first
+   for (std::uint64_t mode = 1; mode < dims.size(); mode++) 
+   {
+      std::vector<std::uint64_t> row_ptr;
+      std::vector<std::uint32_t> perm;
+      sortByMode(idx, mode, dims[mode], row_ptr, perm);
+      for (auto &p : perm)
+         p = stored_at[p];
+
+      modes.push_back(std::shared_ptr<SparseMode>(new SparseMode(mode, std::move(row_ptr), std::move(perm), indices, values)));
+   }
+
+   return modes;
 }
 
 std::uint64_t SparseMode::getNNZ() const
 { 
-   return m_indices.rows(); 
+   return m_row_ptr.empty() ? 0 : m_row_ptr.back(); 
 }
 
 std::uint64_t SparseMode::getNPlanes() const
@@ -93,12 +185,7 @@ std::uint64_t SparseMode::getNPlanes() const
 
 std::uint64_t SparseMode::getNCoords() const
 {
-   return m_indices.cols();
-}
-
-const std::vector<double>& SparseMode::getValues() const
-{
-   return m_values;
+   return m_indices ? m_indices->cols() - 1 : 0;
 }
 
 std::uint64_t SparseMode::getMode() const
@@ -121,9 +208,15 @@ std::uint64_t SparseMode::nItemsOnPlane(std::uint64_t hyperplane) const
    return endPlane(hyperplane) - beginPlane(hyperplane);
 }
 
-const MatrixXui32& SparseMode::getIndices() const
+std::uint64_t SparseMode::ownBytes() const
+{
+   return m_row_ptr.size() * sizeof(std::uint64_t) + m_perm.size() * sizeof(std::uint32_t);
+}
+
+std::uint64_t SparseMode::sharedBytes() const
 {
-   return m_indices;
+   if (!m_indices) return 0;
+   return m_indices->size() * sizeof(std::uint32_t) + m_values->size() * sizeof(double);
 }
 
 std::pair<PVec<>, double> SparseMode::item(std::uint64_t hyperplane, std::uint64_t item) const
@@ -141,15 +234,12 @@ std::pair<PVec<>, double> SparseMode::item(std::uint64_t hyperplane, std::uint64
 
    std::uint64_t itemIndex = this->beginPlane(hyperplane) + item; //select item in hyperplane
 
-   std::uint64_t m = 0;
-   for(std::uint64_t ci = 0; ci < coords.size(); ci++) //go through each coordinate of the item
+   for(std::uint64_t m = 0; m < this->getNCoords(); m++) //go through each coordinate of the item
    {
-      //if this is not a fixed coordinate
-      if(ci != m_mode)
-         coords[ci] = static_cast<int>(this->getIndices()(itemIndex, m++)); //get item coordinate
+      coords[m < m_mode ? m : m + 1] = static_cast<int>(this->coord(itemIndex, m)); //get item coordinate
    }
 
-   return std::make_pair(coords, this->getValues()[itemIndex]);
+   return std::make_pair(coords, this->value(itemIndex));
 }
 
 PVec<> SparseMode::pos(std::uint64_t hyperplane, std::uint64_t item) const
@@ -166,12 +256,9 @@ PVec<> SparseMode::pos(std::uint64_t hyperplane, std::uint64_t item) const
       THROWERROR("Wrong item index");
    }
 
-   std::uint64_t m = 0;
-   for(std::uint64_t ci = 0; ci < coords.size(); ci++) //go through each coordinate of the item
+   for(std::uint64_t m = 0; m < this->getNCoords(); m++) //go through each coordinate of the item
    {
-      //if this is not a fixed coordinate
-      if(ci != m_mode)
-         coords[ci] = static_cast<int>(this->getIndices()(item, m++)); //get item coordinate
+      coords[m < m_mode ? m : m + 1] = static_cast<int>(this->coord(item, m)); //get item coordinate
    }
 
    return coords;
@@ -11,18 +11,30 @@
 
 namespace smurff {
 
-typedef Eigen::Matrix<std::uint32_t, Eigen::Dynamic, Eigen::Dynamic > MatrixXui32;
+// [nnz x nmodes] matrix of coordinates, one row per item
+typedef Eigen::Matrix<std::uint32_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> MatrixXui32;
 
 //this is a tensor rotation where one dimension is fixed (excluded)
+//
+//the coordinates and values are stored once and shared by the rotations of
+//all modes; each rotation only keeps its hyperplane offsets and, if its order
+//differs from the storage order, a permutation into the shared storage
 class SparseMode
 {
 private:
    std::uint64_t m_mode; // index of dimension that it fixed
 
-   std::vector<std::uint64_t> m_row_ptr; // vector of offsets (in values and in indices) to each hyperplane
-   MatrixXui32 m_indices; // [m_nnz x (m_nmodes - 1)] matrix of coordinates
-   std::vector<double> m_values; // vector of values
-   
+   std::vector<std::uint64_t> m_row_ptr; // vector of offsets (in m_perm) to each hyperplane
+   std::vector<std::uint32_t> m_perm; // index in storage of each item, empty if stored in this order
+   std::shared_ptr<const MatrixXui32> m_indices; // [nnz x nmodes] matrix of coordinates, shared
+   std::shared_ptr<const std::vector<double>> m_values; // vector of values, shared
+
+   SparseMode(std::uint64_t mode,
+              std::vector<std::uint64_t> &&row_ptr,
+              std::vector<std::uint32_t> &&perm,
+              std::shared_ptr<const MatrixXui32> indices,
+              std::shared_ptr<const std::vector<double>> values);
+
 public:
    SparseMode();
 
@@ -32,14 +44,18 @@ public:
    // mode_size - size of dimension to fix
    SparseMode(const MatrixXui32& idx, const std::vector<double>& vals, std::uint64_t mode, std::uint64_t mode_size);
 
+   // rotations for all modes, sharing a single copy of idx and vals
+   // idx - [nnz x nmodes] matrix of coordinates
+   // vals - vector of values
+   // dims - size of each dimension
+   static std::vector<std::shared_ptr<SparseMode> > createAll(const MatrixXui32& idx, const std::vector<double>& vals, const std::vector<std::uint64_t>& dims);
+
    std::uint64_t getNNZ() const;
 
    std::uint64_t getNPlanes() const;
 
    std::uint64_t getNCoords() const;
 
-   const std::vector<double>& getValues() const;
-
    std::uint64_t getMode() const;
 
    std::uint64_t beginPlane(std::uint64_t hyperplane) const;
@@ -48,7 +64,30 @@ public:
 
    std::uint64_t nItemsOnPlane(std::uint64_t hyperplane) const;
 
-   const MatrixXui32& getIndices() const;
+   // bytes used by this rotation, excluding the shared storage
+   std::uint64_t ownBytes() const;
+
+   // bytes used by the shared storage
+   std::uint64_t sharedBytes() const;
+
+public:
+   // index in the shared storage of the item at position j
+   std::uint64_t entry(std::uint64_t j) const
+   {
+      return m_perm.empty() ? j : m_perm[j];
+   }
+
+   // m'th coordinate (fixed dimension excluded) of the item at position j
+   std::uint32_t coord(std::uint64_t j, std::uint64_t m) const
+   {
+      return (*m_indices)(entry(j), m < m_mode ? m : m + 1);
+   }
+
+   // value of the item at position j
+   double value(std::uint64_t j) const
+   {
+      return (*m_values)[entry(j)];
+   }
 
 public:
    std::pair<PVec<>, double> item(std::uint64_t hyperplane, std::uint64_t item) const;
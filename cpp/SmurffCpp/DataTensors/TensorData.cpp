@@ -47,10 +47,7 @@ TensorData::TensorData(const DenseTensor& ts)
    //combine coordinates into [nnz x nmodes] matrix
    MatrixXui32 idx = toMatrixNew(ts);
 
-   for (std::uint64_t mode = 0; mode < ts.getNModes(); mode++) 
-   {
-      m_Y->push_back(std::make_shared<SparseMode>(idx, ts.getValues(), mode, m_dims[mode]));
-   }
+   *m_Y = SparseMode::createAll(idx, ts.getValues(), m_dims);
 
    this->name = "DenseTensorData";
 }
@@ -64,10 +61,7 @@ TensorData::TensorData(const SparseTensor& ts)
    //combine coordinates into [nnz x nmodes] matrix
    MatrixXui32 idx = toMatrixNew(ts);
 
-   for (std::uint64_t mode = 0; mode < ts.getNModes(); mode++) 
-   {
-      m_Y->push_back(std::make_shared<SparseMode>(idx, ts.getValues(), mode, m_dims[mode]));
-   }
+   *m_Y = SparseMode::createAll(idx, ts.getValues(), m_dims);
 
    this->name = "SparseTensorData";
 }
@@ -81,7 +75,8 @@ std::shared_ptr<SparseMode> TensorData::Y(std::uint64_t mode) const
 
 void TensorData::init_pre()
 {
-   //no logic here
+   // the number of threads may have changed since construction
+   m_prefix.init();
 }
 
 double TensorData::sum() const
@@ -95,7 +90,7 @@ double TensorData::sum() const
    {
       for(std::uint64_t j = sview->beginPlane(n); j < sview->endPlane(n); j++) //go through each item in the plane
       {
-         esum += sview->getValues()[j];
+         esum += sview->value(j);
       }
    }
 
@@ -130,6 +125,32 @@ double TensorData::train_rmse(const SubModel& model) const
    return std::sqrt(sumsq(model) / this->nnz());
 }
 
+void TensorData::hadamardRow(const SubModel& model, const SparseMode& sview, std::uint64_t j, std::uint64_t begin, Matrix& P) const
+{
+   const std::uint64_t ncoords = sview.getNCoords();
+   if (P.rows() != (Eigen::Index)ncoords || P.cols() != model.nlatent())
+      P.resize(ncoords, model.nlatent());
+
+   // first coordinate where item j differs from item j - 1,
+   // items are in fiber order so this skips the common prefix
+   std::uint64_t m0 = 0;
+   if (j > begin)
+      while (m0 < ncoords - 1 && sview.coord(j, m0) == sview.coord(j - 1, m0))
+         m0++;
+
+   auto V = model.CVbegin(sview.getMode()); //get V matrices for mode
+   for (std::uint64_t m = 0; m < m0; m++)
+      ++V;
+
+   for (std::uint64_t m = m0; m < ncoords; m++, ++V) //go through each remaining coordinate of value
+   {
+      if (m == 0)
+         P.row(0) = (*V).row(sview.coord(j, 0)); //copy of m'th column from V (m = 0)
+      else
+         P.row(m) = P.row(m - 1).cwiseProduct((*V).row(sview.coord(j, m))); //multiply by m'th column from V
+   }
+}
+
 //d is an index of column in U matrix
 //this function selects d'th hyperplane from mode`th SparseMode
 //it does j multiplications
@@ -137,34 +158,85 @@ double TensorData::train_rmse(const SubModel& model) const
 void TensorData::getMuLambda(const SubModel& model, uint32_t mode, int d, Vector& rr, Matrix& MM) const
 {
    std::shared_ptr<SparseMode> sview = Y(mode); //get tensor rotation for mode
+   Matrix &P = m_prefix.local();
    
-   auto V0 = model.CVbegin(mode); //get first V matrix
    for (std::uint64_t j = sview->beginPlane(d); j < sview->endPlane(d); j++) //go through hyperplane in tensor rotation
    {
-      Vector row = (*V0).row(sview->getIndices()(j, 0)); //create a copy of m'th column from V (m = 0)
-      auto V = model.CVbegin(mode); //get V matrices for mode      
-      for (std::uint64_t m = 1; m < sview->getNCoords(); m++) //go through each coordinate of value
-      {
-         ++V; //inc iterator prior to access since we are starting from m = 1
-         row.noalias() = row.cwiseProduct((*V).row(sview->getIndices()(j, m))); //multiply by m'th column from V
-      }
+      hadamardRow(model, *sview, j, sview->beginPlane(d), P);
+      auto row = P.row(P.rows() - 1); // product of columns in each V
       MM.triangularView<Eigen::Lower>() += noise().getAlpha() * row.transpose() * row; // MM = MM + (row * colT) * alpha (where row = product of columns in each V)
       
       auto pos = sview->pos(d, j);
-      double noisy_val = noise().sample(model, pos, sview->getValues()[j]);
+      double noisy_val = noise().sample(model, pos, sview->value(j));
       rr.noalias() += row * noisy_val; // rr = rr + (row * value) * alpha (where value = j'th value of Y)
    }
 
    MM.triangularView<Eigen::Upper>() = MM.transpose();
 }
 
+bool TensorData::getMuLowRank(const SubModel& model, uint32_t mode, int d, int max_rank, Vector& rr, Matrix& Vd, int& rank) const
+{
+   std::shared_ptr<SparseMode> sview = Y(mode); //get tensor rotation for mode
+
+   //dense tensors are not scarce
+   const std::uint64_t nItems = sview->nItemsOnPlane(d);
+   if (nna() == 0 || nItems >= (std::uint64_t)max_rank)
+      return false;
+
+   const double sqrt_alpha = std::sqrt(noise().getAlpha());
+   THROWERROR_ASSERT(Vd.rows() >= max_rank && Vd.cols() == model.nlatent());
+   rank = nItems;
+
+   Matrix &P = m_prefix.local();
+   for (std::uint64_t j = sview->beginPlane(d); j < sview->endPlane(d); j++) //go through hyperplane in tensor rotation
+   {
+      hadamardRow(model, *sview, j, sview->beginPlane(d), P);
+      auto row = Vd.row(j - sview->beginPlane(d));
+      row = P.row(P.rows() - 1);
+
+      auto pos = sview->pos(d, j);
+      double noisy_val = noise().sample(model, pos, sview->value(j));
+      rr.noalias() += row * noisy_val;
+      row *= sqrt_alpha;
+   }
+
+   return true;
+}
+
+std::uint64_t TensorData::row_nnz(uint32_t mode, int d) const
+{
+   return Y(mode)->nItemsOnPlane(d);
+}
+
 void TensorData::update_pnm(const SubModel& model, uint32_t mode)
 {
    //do not need to cache VV here
+
+   // residuals will be complete after sampling the last mode
+   m_residuals_valid = m_residuals.size() && mode == nmode() - 1;
+}
+
+void TensorData::update_residuals(const SubModel& model, uint32_t mode, int d)
+{
+   if (!m_residuals_valid || mode != nmode() - 1)
+      return;
+
+   std::shared_ptr<SparseMode> sview = Y(mode);
+   double pred[Model::PREDICT_BATCH];
+   for (std::uint64_t start = sview->beginPlane(d); start < sview->endPlane(d); start += Model::PREDICT_BATCH)
+   {
+      const std::uint64_t n = std::min<std::uint64_t>(Model::PREDICT_BATCH, sview->endPlane(d) - start);
+      model.predict([&sview, d, start](std::size_t k) { return sview->pos(d, start + k); }, n, pred);
+      for (std::uint64_t j = 0; j < n; j++)
+         m_residuals(start + j) = pred[j] - sview->value(start + j);
+   }
 }
 
 double TensorData::sumsq(const SubModel& model) const
 {
+   if (m_residuals_valid)
+      return sumsq_residuals();
+
    double sumsq = 0.0;
 
    std::shared_ptr<SparseMode> sview = Y(0);
@@ -172,11 +244,13 @@ double TensorData::sumsq(const SubModel& model) const
    #pragma omp parallel for schedule(guided) reduction(+:sumsq)
    for(std::uint64_t h = 0; h < sview->getNPlanes(); h++) //go through each hyperplane
    {
-      for(std::uint64_t n = 0; n < sview->nItemsOnPlane(h); n++) //go through each item in the hyperplane
+      double pred[Model::PREDICT_BATCH];
+      for(std::uint64_t start = sview->beginPlane(h); start < sview->endPlane(h); start += Model::PREDICT_BATCH) //items in the hyperplane, in batches
       {
-         auto item = sview->item(h, n);
-         double pred = model.predict(item.first);
-         sumsq += std::pow(pred - item.second, 2);
+         const std::uint64_t n = std::min<std::uint64_t>(Model::PREDICT_BATCH, sview->endPlane(h) - start);
+         model.predict([&sview, h, start](std::size_t k) { return sview->pos(h, start + k); }, n, pred);
+         for(std::uint64_t j = 0; j < n; j++)
+            sumsq += std::pow(pred[j] - sview->value(start + j), 2);
       }
    }
 
@@ -243,6 +317,11 @@ std::ostream& TensorData::info(std::ostream& os, std::string indent)
    }
 
    os << m_dims.back() << "] (" << std::fixed << std::setprecision(2) << train_fill_rate << "%)\n";
+
+   std::uint64_t bytes = Y(0)->sharedBytes();
+   for (const auto &sview : *m_Y)
+      bytes += sview->ownBytes();
+   os << indent << "Storage: " << bytes << " bytes (coordinates and values shared by all modes)\n";
    
    return os;
 }
@@ -11,6 +11,7 @@
 #include "SparseMode.h"
 #include <SmurffCpp/DataMatrices/Data.h>
 #include <SmurffCpp/Utils/PVec.hpp>
+#include <SmurffCpp/Utils/ThreadVector.hpp>
 
 namespace smurff {
 
@@ -20,6 +21,7 @@ private:
    std::vector<std::uint64_t> m_dims; //vector of dimension sizes
    std::uint64_t m_nnz;
    std::shared_ptr<std::vector<std::shared_ptr<SparseMode> > > m_Y; // this is a vector of tensor rotations
+   mutable thread_vector<Matrix> m_prefix; // per-thread partial Hadamard products, see hadamardRow
 
 public:
    TensorData(const smurff::DenseTensor& ts);
@@ -30,6 +32,12 @@ public:
 protected:
    void init_pre() override;
 
+private:
+   // product of the V rows of the j'th item in hyperplane of sview, in the last row of P
+   // rows of P are products of the first V rows, and are reused from item j - 1
+   // as long as both items share those coordinates
+   void hadamardRow(const SubModel& model, const SparseMode& sview, std::uint64_t j, std::uint64_t begin, Matrix& P) const;
+
 public:
    double sum() const override;
 
@@ -42,7 +50,10 @@ public:
 public:
    double train_rmse(const SubModel& model) const override;
    void getMuLambda(const SubModel& model, uint32_t mode, int d, Vector& rr, Matrix& MM) const override;
+   bool getMuLowRank(const SubModel& model, uint32_t mode, int d, int max_rank, Vector& rr, Matrix& Vd, int& rank) const override;
    void update_pnm(const SubModel& model, uint32_t mode) override;
+   void update_residuals(const SubModel& model, uint32_t mode, int d) override;
+   std::uint64_t row_nnz(uint32_t mode, int d) const override;
 
 public:
    double sumsq(const SubModel& model) const override;
@@ -11,6 +11,8 @@
 
 #include <SmurffCpp/DataMatrices/Data.h>
 #include <SmurffCpp/Utils/Distribution.h>
+#include <SmurffCpp/Utils/FixedKernels.hpp>
+#include <SmurffCpp/Utils/PackedSymmetric.hpp>
 
 #include <SmurffCpp/Model.h>
 
@@ -24,6 +26,8 @@
 
 namespace smurff {
 
+const int Model::PREDICT_BATCH;
+
 Model::Model()
    : m_num_latent(-1), m_dims(0)
 {
@@ -68,11 +72,13 @@ void Model::init(int num_latent, const PVec<>& dims, ModelInitTypes model_init_t
       if (aggregate)
       {
          m_aggr_sum.push_back(Matrix::Zero(dims[i], m_num_latent));
-         m_aggr_dot.push_back(Matrix::Zero(dims[i], m_num_latent * m_num_latent));
+         m_aggr_dot.push_back(AggrMatrix::Zero(dims[i], packed::size(m_num_latent)));
       }
    }
 
    Pcache.init(Array1D::Ones(m_num_latent));
+   SumCache.init(Eigen::ArrayXd::Ones(m_num_latent));
+   DotCache.init(Eigen::ArrayXd::Ones(packed::size(m_num_latent)));
 }
 
 Matrix &Model::getLinkMatrix(int mode)
@@ -99,14 +105,58 @@ double Model::predict(const PVec<> &pos) const
 {
    if (nmodes() == 2)
    {
-      return row(0, pos[0]).dot(row(1, pos[1]));
+      return kernels::dot(row(0, pos[0]), row(1, pos[1]));
    }
 
-   auto &P = Pcache.local();
-   P.setOnes();
+   return kernels::dispatch(m_num_latent, [this, &pos](auto k) -> double {
+      constexpr int K = decltype(k)::value;
+      Eigen::Map<Eigen::Array<float_type, 1, K, Eigen::RowMajor>> P(Pcache.local().data(), m_num_latent);
+      P.setOnes();
+      for(uint32_t d = 0; d < nmodes(); ++d)
+         P *= row(d, pos.at(d)).template head<K>(m_num_latent).array();
+      return P.sum();
+   });
+}
+
+void Model::predictSummary(const PVec<>& pos, double &mean, double &var) const
+{
+   THROWERROR_ASSERT(pos.size() == nmodes());
+
+   auto &S = SumCache.local();
+   auto &D = DotCache.local();
+   S.setOnes();
+   D.setOnes();
+
+   // E[u_1 .* ... .* u_N] and E[(u_1 .* ... .* u_N)' * (u_1 .* ... .* u_N)], packed
    for(uint32_t d = 0; d < nmodes(); ++d)
-      P *= row(d, pos.at(d)).array();
-   return P.sum();
+   {
+      const double n = m_num_aggr.at(d);
+      S *= m_aggr_sum.at(d).row(pos.at(d)).array().template cast<double>().transpose() / n;
+      D *= m_aggr_dot.at(d).row(pos.at(d)).array().template cast<double>().transpose() / n;
+   }
+
+   // E[pred^2] is the sum of the full symmetric matrix: off-diagonal entries count twice
+   double second = 0.0;
+   Eigen::Index idx = 0;
+   for (int r = 0; r < m_num_latent; ++r, ++idx)
+   {
+      second += 2.0 * D.segment(idx, r).sum();
+      idx += r;
+      second += D(idx);
+   }
+
+   mean = S.sum();
+   var = std::max(0.0, second - mean * mean);
+}
+
+void Model::predict(std::uint32_t mode, int n, const int *index, std::size_t count, double *out, int index_offset) const
+{
+   THROWERROR_ASSERT(nmodes() == 2 && mode < 2);
+
+   kernels::dispatch(m_num_latent, [&](auto k) {
+      kernels::gather_dot<decltype(k)::value>(row(mode, n), U(1 - mode),
+         [index, index_offset](std::size_t j) { return index_offset + index[j]; }, count, out);
+   });
 }
 
 const Matrix &Model::U(uint32_t f) const
@@ -175,9 +225,8 @@ void Model::updateAggr(int m, int i)
    if (!m_collect_aggr) return;
 
    const auto &r = row(m, i);
-   Matrix cov = (r.transpose() * r);
    m_aggr_sum.at(m).row(i) += r;
-   m_aggr_dot.at(m).row(i) += Eigen::Map<Vector>(cov.data(), nlatent() * nlatent());
+   packed::rank_update(m_aggr_dot.at(m).row(i), r);
 }
 
 void Model::updateAggr(int m)
@@ -197,23 +246,24 @@ void Model::save(SaveState &sf) const
       {
          int n = m_num_aggr.at(m);
          const Matrix &Usum = m_aggr_sum.at(m);
-         const Matrix &Uprod = m_aggr_dot.at(m);
+         const AggrMatrix &Uprod = m_aggr_dot.at(m);
          if (sf.isCheckpoint())
             sf.putAggr(m, n, Usum, Uprod);
          else
          {
             // compute mean and precision (inverse of the covariance)
             Matrix mu = Matrix::Zero(Usum.rows(), Usum.cols());
-            Matrix prec = Matrix::Zero(Uprod.rows(), Uprod.cols());
+            AggrMatrix prec = AggrMatrix::Zero(Uprod.rows(), Uprod.cols());
 
             // calculate real mu and Lambda
+            Matrix prod;
             for (int i = 0; i < U(m).rows(); i++)
             {
                Vector sum = Usum.row(i);
-               Matrix prod = Eigen::Map<const Matrix>(Uprod.row(i).data(), nlatent(), nlatent());
+               packed::unpack(prod, Uprod.row(i), nlatent());
                Matrix prec_i = ((prod - (sum.transpose() * sum / n)) / (n - 1)).inverse();
 
-               prec.row(i) = Eigen::Map<Vector>(prec_i.data(), nlatent() * nlatent());
+               packed::pack(prec.row(i), prec_i);
                mu.row(i) = sum / n;
             }
 
@@ -247,7 +297,7 @@ void Model::restore(const SaveState &sf, int skip_mode)
          {
             int        &n = m_num_aggr.at(i);
             Matrix  &Usum = m_aggr_sum.at(i);
-            Matrix &Uprod = m_aggr_dot.at(i);
+            AggrMatrix &Uprod = m_aggr_dot.at(i);
             sf.readAggr(i, n, Usum, Uprod);
          }
       }
@@ -267,6 +317,46 @@ void Model::restore(const SaveState &sf, int skip_mode)
    }
 
    Pcache.init(Array1D::Ones(m_num_latent));
+   SumCache.init(Eigen::ArrayXd::Ones(m_num_latent));
+   DotCache.init(Eigen::ArrayXd::Ones(packed::size(m_num_latent)));
+}
+
+void Model::restore(const SaveState &sf, const std::vector<std::vector<int>> &rows)
+{
+   unsigned nmodes = sf.getNModes();
+   THROWERROR_ASSERT(rows.size() == nmodes);
+
+   m_factors.clear();
+   m_dims = PVec<>(nmodes);
+   m_factors.resize(nmodes);
+
+   m_num_aggr.clear();
+   m_aggr_sum.clear();
+   m_aggr_dot.clear();
+   m_link_matrices.clear();
+   m_mus.clear();
+
+   for (std::uint64_t i = 0; i < nmodes; ++i)
+   {
+      m_dims.at(i) = sf.readModel(i, rows.at(i), m_factors.at(i));
+      m_num_latent = m_factors.at(i).cols();
+   }
+
+   Pcache.init(Array1D::Ones(m_num_latent));
+   SumCache.init(Eigen::ArrayXd::Ones(m_num_latent));
+   DotCache.init(Eigen::ArrayXd::Ones(packed::size(m_num_latent)));
+}
+
+bool Model::hasAggr() const
+{
+   if (m_num_aggr.size() != nmodes() || m_aggr_sum.size() != nmodes() || m_aggr_dot.size() != nmodes())
+      return false;
+
+   for (std::uint64_t m = 0; m < nmodes(); ++m)
+      if (m_num_aggr.at(m) <= 0)
+         return false;
+
+   return true;
 }
 
 std::ostream& Model::info(std::ostream &os, std::string indent) const
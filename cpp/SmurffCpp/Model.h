@@ -8,6 +8,7 @@
 #include <SmurffCpp/Utils/PVec.hpp>
 #include <SmurffCpp/Utils/ThreadVector.hpp>
 #include <SmurffCpp/Utils/Error.h>
+#include <SmurffCpp/Utils/FixedKernels.hpp>
 
 #include <SmurffCpp/Configs/Config.h>
 
@@ -40,7 +41,7 @@ private:
 
    bool m_collect_aggr;
    std::vector<Matrix> m_aggr_sum; //vector of aggr summed m_factors matrices
-   std::vector<Matrix> m_aggr_dot; //vector of aggr dot m_factors matrices
+   std::vector<AggrMatrix> m_aggr_dot; //vector of aggr dot m_factors matrices, packed lower triangle per row
    std::vector<int> m_num_aggr; //number of aggregated samples in above vectors
 
    int m_num_latent; //size of latent dimension for U matrices
@@ -48,6 +49,7 @@ private:
 
    // to make predictions faster
    mutable thread_vector<Array1D> Pcache;
+   mutable thread_vector<Eigen::ArrayXd> SumCache, DotCache; // for predictSummary
 
 public:
    Model();
@@ -68,6 +70,24 @@ public:
    //pos - vector of column indices
    double predict(const PVec<>& pos) const;
 
+   // batched predict: out[k] = predict(coords(k)), k < n, where coords(k) gives a PVec<>
+   // Consecutive items with the same coordinates in all but the last mode (e.g. the items
+   // of a row) share the product of those rows; the rows of the last mode are gathered
+   // in tiles, see kernels::gather_dot.
+   template<typename Coords>
+   void predict(const Coords &coords, std::size_t n, double *out) const;
+
+   // two modes: out[k] = U(mode).row(n) . U(1 - mode).row(index_offset + index[k]), k < count
+   void predict(std::uint32_t mode, int n, const int *index, std::size_t count, double *out, int index_offset = 0) const;
+
+   // moment-matched prediction at pos from the aggregates of all modes (see hasAggr):
+   // the mean and variance of the prediction when the rows of different modes are
+   // independent, each with the posterior mean and second moment of its samples
+   void predictSummary(const PVec<>& pos, double &mean, double &var) const;
+
+   // items per call of the batched predict in the loops over all data
+   static const int PREDICT_BATCH = 256;
+
    // for each row in feature matrix f: compute latent vector from feature vector
    template<typename FeatMatrix>
    std::shared_ptr<Matrix> predict_latent(int mode, const FeatMatrix& f);
@@ -116,12 +136,25 @@ public:
    void updateAggr(int m);
    void updateAggr(int m, int n);
 
+   int getNumAggr(int m) const { return m_num_aggr.at(m); }
+   // true if all modes have aggregated samples
+   bool hasAggr() const;
+   const Matrix &getAggrSum(int m) const { return m_aggr_sum.at(m); }
+   const AggrMatrix &getAggrDot(int m) const { return m_aggr_dot.at(m); }
+
 public:
    // output to file
    void save(SaveState &sf) const;
    bool m_save_model = true;
    void restore(const SaveState &sf, int skip_mode = -1);
 
+   // restores only rows[m] (sorted, unique) of each U(m), in that order, for predictions
+   // at coordinates remapped to these rows. getDims() still gives the stored dimensions,
+   // so U(m).rows() is rows[m].size(), not getDims()[m]: code that relies on the two
+   // matching (e.g. SubModel, iterating over all rows) must not use such a model.
+   // Link matrices, mus and aggregates are not restored.
+   void restore(const SaveState &sf, const std::vector<std::vector<int>> &rows);
+
    std::ostream& info(std::ostream &os, std::string indent) const;
    std::ostream& status(std::ostream &os, std::string indent) const;
 };
@@ -160,6 +193,18 @@ public:
       return m_model.predict(m_off + pos);
    }
 
+   // batched predict, see Model
+   template<typename Coords>
+   void predict(const Coords &coords, std::size_t n, double *out) const
+   {
+      m_model.predict([this, &coords](std::size_t k) { return m_off + coords(k); }, n, out);
+   }
+
+   void predict(std::uint32_t mode, int n, const int *index, std::size_t count, double *out) const
+   {
+      m_model.predict(mode, m_off[mode] + n, index, count, out, m_off[1 - mode]);
+   }
+
    //size of latent dimension
    int nlatent() const
    {
@@ -174,6 +219,39 @@ public:
 };
 
 
+template<typename Coords>
+void Model::predict(const Coords &coords, std::size_t n, double *out) const
+{
+   const std::uint32_t last = nmodes() - 1;
+
+   kernels::dispatch(m_num_latent, [&](auto k) {
+      constexpr int K = decltype(k)::value;
+      Eigen::Matrix<float_type, 1, K, Eigen::RowMajor> h(m_num_latent);
+
+      for (std::size_t i = 0; i < n;)
+      {
+         const PVec<> first = coords(i);
+         h = row(0, first[0]).template head<K>(m_num_latent);
+         for (std::uint32_t d = 1; d < last; ++d)
+            h.array() *= row(d, first[d]).template head<K>(m_num_latent).array();
+
+         std::size_t end = i + 1;
+         for (; end < n; ++end)
+         {
+            const PVec<> pos = coords(end);
+            std::uint32_t d = 0;
+            while (d < last && pos[d] == first[d])
+               ++d;
+            if (d < last)
+               break;
+         }
+
+         kernels::gather_dot<K>(h, U(last), [&coords, i, last](std::size_t j) { return coords(i + j)[last]; }, end - i, out + i);
+         i = end;
+      }
+   });
+}
+
 template<typename FeatMatrix>
 std::shared_ptr<Matrix> Model::predict_latent(int mode, const FeatMatrix& f)
 {
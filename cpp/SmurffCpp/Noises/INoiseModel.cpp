@@ -13,4 +13,13 @@ double INoiseModel::sample(const SubModel& model, const PVec<> &pos, double val)
 {
     return getAlpha() * val;
 }
+
+void INoiseModel::sample(const SubModel& model, std::uint32_t mode, int n, const int *index, float_type *val, int count)
+{
+    for (int k = 0; k < count; ++k)
+    {
+        const PVec<> pos = (mode == 0) ? PVec<>({n, index[k]}) : PVec<>({index[k], n});
+        val[k] = sample(model, pos, val[k]);
+    }
+}
 } // end namespace smurff
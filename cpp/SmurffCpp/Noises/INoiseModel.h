@@ -41,5 +41,11 @@ namespace smurff {
 
       virtual double getAlpha() const;
       virtual double sample(const SubModel& model, const PVec<> &pos, double val);
+
+      // sample() of the values val[k] at column index[k] of row n in mode `mode` of a matrix, k < count, in place
+      virtual void sample(const SubModel& model, std::uint32_t mode, int n, const int *index, float_type *val, int count);
+
+      // true when sample() returns getAlpha() * val, independent of the model
+      virtual bool isLinear() const { return true; }
    };
 }
@@ -27,6 +27,22 @@ double ProbitNoise::sample(const SubModel& model, const PVec<> &pos, double val)
     return sign * rand_truncnorm(pred * sign, 1.0, 0.0);
 }
 
+// as above, with the predictions of the row in batches
+void ProbitNoise::sample(const SubModel& model, std::uint32_t mode, int n, const int *index, float_type *val, int count)
+{
+    double pred[Model::PREDICT_BATCH];
+    for (int start = 0; start < count; start += Model::PREDICT_BATCH)
+    {
+        const int size = std::min(Model::PREDICT_BATCH, count - start);
+        model.predict(mode, n, index + start, size, pred);
+        for (int k = 0; k < size; ++k)
+        {
+            double sign = (val[start + k] < threshold) ? -1. : 1.;
+            val[start + k] = sign * rand_truncnorm(pred[k] * sign, 1.0, 0.0);
+        }
+    }
+}
+
 std::ostream& ProbitNoise::info(std::ostream& os, std::string indent)
 {
    os << "Probit Noise with threshold " << threshold << std::endl;
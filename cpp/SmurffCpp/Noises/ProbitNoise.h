@@ -22,6 +22,8 @@ namespace smurff {
 
    public:
       double sample(const SubModel& model, const PVec<> &pos, double val) override;
+      void sample(const SubModel& model, std::uint32_t mode, int n, const int *index, float_type *val, int count) override;
+      bool isLinear() const override { return false; }
 
       std::ostream& info(std::ostream& os, std::string indent) override;
       std::string getStatus() override;
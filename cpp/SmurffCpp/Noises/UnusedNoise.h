@@ -19,6 +19,7 @@ protected:
 public:
    double getAlpha() const override;
    double sample(const SubModel& model, const PVec<> &pos, double val) override;
+   bool isLinear() const override { return false; }
 
    std::ostream& info(std::ostream& os, std::string indent) override;
    std::string getStatus() override;
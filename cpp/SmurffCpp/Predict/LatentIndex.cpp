@@ -0,0 +1,308 @@
+#include "LatentIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include <SmurffCpp/Utils/Error.h>
+#include <SmurffCpp/Utils/HDF5Group.h>
+#include <SmurffCpp/Utils/TopK.hpp>
+
+namespace smurff {
+
+static const std::string INDEX_METRIC_NAME_INNER_PRODUCT = "inner_product";
+static const std::string INDEX_METRIC_NAME_COSINE = "cosine";
+
+static const std::string OPTIONS_TAG = "options";
+static const std::string METRIC_TAG = "metric";
+static const std::string ISAMPLE_TAG = "isample";
+static const std::string NPROBE_TAG = "nprobe";
+static const std::string RECALL_TAG = "recall";
+
+static const std::string LISTS_TAG = "lists";
+static const std::string CENTROIDS_TAG = "centroids";
+static const std::string OFFSETS_TAG = "offsets";
+static const std::string IDS_TAG = "ids";
+static const std::string VECTORS_TAG = "vectors";
+
+// rows assigned to lists per block during k-means
+static const int ASSIGN_BLOCK = 1024;
+
+IndexMetric stringToIndexMetric(std::string name)
+{
+   if (name == INDEX_METRIC_NAME_INNER_PRODUCT)
+      return IndexMetric::inner_product;
+   else if (name == INDEX_METRIC_NAME_COSINE)
+      return IndexMetric::cosine;
+   else
+   {
+      THROWERROR("Invalid index metric " + name);
+   }
+}
+
+std::string indexMetricToString(IndexMetric type)
+{
+   switch (type)
+   {
+      case IndexMetric::inner_product:
+         return INDEX_METRIC_NAME_INNER_PRODUCT;
+      case IndexMetric::cosine:
+         return INDEX_METRIC_NAME_COSINE;
+      default:
+      {
+         THROWERROR("Invalid index metric");
+      }
+   }
+}
+
+static void normalize_rows(Matrix &X)
+{
+   for (Eigen::Index i = 0; i < X.rows(); ++i)
+   {
+      const float_type norm = X.row(i).norm();
+      if (norm > 0)
+         X.row(i) /= norm;
+   }
+}
+
+// the nearest centroid of each row of V: largest v . c - |c|^2 / 2
+static void assign_lists(const Matrix &V, const Matrix &C, std::vector<int> &lists)
+{
+   const Vector half_norm = 0.5 * C.rowwise().squaredNorm().transpose();
+   const int n = V.rows();
+   const int nblocks = (n + ASSIGN_BLOCK - 1) / ASSIGN_BLOCK;
+
+   lists.resize(n);
+
+   #pragma omp parallel for schedule(static)
+   for (int b = 0; b < nblocks; ++b)
+   {
+      const int r0 = b * ASSIGN_BLOCK;
+      const int nr = std::min(ASSIGN_BLOCK, n - r0);
+
+      Matrix S = V.middleRows(r0, nr) * C.transpose();
+      S.rowwise() -= half_norm;
+      for (int i = 0; i < nr; ++i)
+      {
+         Eigen::Index l;
+         S.row(i).maxCoeff(&l);
+         lists[r0 + i] = l;
+      }
+   }
+}
+
+const int LatentIndex::DEFAULT_ITERATIONS;
+const int LatentIndex::RECALL_QUERIES;
+const int LatentIndex::RECALL_K;
+
+LatentIndex::LatentIndex()
+   : m_metric(IndexMetric::inner_product), m_isample(-1), m_offsets(1, 0), m_nprobe(1), m_recall(NAN)
+{
+}
+
+LatentIndex::LatentIndex(const Matrix &X, IndexMetric metric, int nlist, int nprobe, int iterations, std::int32_t isample)
+   : m_metric(metric), m_isample(isample), m_nprobe(1), m_recall(NAN)
+{
+   const int n = X.rows();
+
+   Matrix V = X;
+   if (m_metric == IndexMetric::cosine)
+      normalize_rows(V);
+
+   if (nlist <= 0)
+      nlist = std::lround(std::sqrt(n));
+   nlist = std::max(std::min(nlist, n), n ? 1 : 0);
+
+   // k-means, starting from rows spread evenly over X; the last pass only assigns
+   m_centroids.resize(nlist, X.cols());
+   for (int l = 0; l < nlist; ++l)
+      m_centroids.row(l) = V.row(static_cast<std::int64_t>(l) * n / nlist);
+
+   std::vector<int> lists;
+   for (int it = 0; ; ++it)
+   {
+      assign_lists(V, m_centroids, lists);
+      if (it >= iterations)
+         break;
+
+      Matrix sum = Matrix::Zero(nlist, X.cols());
+      std::vector<int> count(nlist, 0);
+      for (int i = 0; i < n; ++i)
+      {
+         sum.row(lists[i]) += V.row(i);
+         count[lists[i]]++;
+      }
+
+      // an empty list keeps its centroid
+      for (int l = 0; l < nlist; ++l)
+         if (count[l])
+            m_centroids.row(l) = sum.row(l) / count[l];
+   }
+
+   // rows sorted by list
+   m_offsets.assign(nlist + 1, 0);
+   for (int i = 0; i < n; ++i)
+      m_offsets[lists[i] + 1]++;
+   std::partial_sum(m_offsets.begin(), m_offsets.end(), m_offsets.begin());
+
+   std::vector<int> next(m_offsets.begin(), m_offsets.end() - 1);
+   m_ids.resize(n);
+   m_vectors.resize(n, X.cols());
+   for (int i = 0; i < n; ++i)
+   {
+      const int j = next[lists[i]]++;
+      m_ids[j] = i;
+      m_vectors.row(j) = V.row(i);
+   }
+
+   m_nprobe = (nprobe > 0) ? std::min(nprobe, std::max(nlist, 1)) : std::max(1, nlist / 8);
+
+   measureRecall(X);
+}
+
+void LatentIndex::measureRecall(const Matrix &Q)
+{
+   THROWERROR_ASSERT_MSG(Q.cols() == nlatent(), "Queries have " + std::to_string(Q.cols()) + " latents, index has " + std::to_string(nlatent()));
+
+   const int nqueries = std::min<std::int64_t>(RECALL_QUERIES, Q.rows());
+   Matrix queries(nqueries, Q.cols());
+   for (int i = 0; i < nqueries; ++i)
+      queries.row(i) = Q.row(static_cast<std::int64_t>(i) * Q.rows() / nqueries);
+   m_recall = recall(queries, std::min(RECALL_K, size()), m_nprobe);
+}
+
+void LatentIndex::search(const Vector &q, int k, int nprobe, std::vector<int> &ids, std::vector<float_type> &scores) const
+{
+   THROWERROR_ASSERT_MSG(q.size() == nlatent(), "Query has " + std::to_string(q.size()) + " latents, index has " + std::to_string(nlatent()));
+   THROWERROR_ASSERT(k >= 0);
+
+   Vector query = q;
+   if (m_metric == IndexMetric::cosine && query.norm() > 0)
+      query /= query.norm();
+
+   nprobe = std::min(nprobe > 0 ? nprobe : m_nprobe, nlist());
+
+   // the nprobe lists whose centroids score best
+   const Vector centroid_scores = query * m_centroids.transpose();
+   std::vector<int> lists(nlist());
+   std::iota(lists.begin(), lists.end(), 0);
+   std::partial_sort(lists.begin(), lists.begin() + nprobe, lists.end(), [&centroid_scores](int a, int b) {
+      return centroid_scores(a) > centroid_scores(b) || (centroid_scores(a) == centroid_scores(b) && a < b);
+   });
+
+   TopK best(k);
+   Vector list_scores;
+   for (int p = 0; p < nprobe; ++p)
+   {
+      const int begin = m_offsets[lists[p]];
+      const int len = m_offsets[lists[p] + 1] - begin;
+      if (len == 0)
+         continue;
+
+      list_scores.noalias() = query * m_vectors.middleRows(begin, len).transpose();
+      for (int j = 0; j < len; ++j)
+         best.push(list_scores(j), m_ids[begin + j]);
+   }
+
+   const auto &sorted = best.sorted();
+   ids.resize(sorted.size());
+   scores.resize(sorted.size());
+   for (std::size_t j = 0; j < sorted.size(); ++j)
+   {
+      scores[j] = sorted[j].first;
+      ids[j] = sorted[j].second;
+   }
+}
+
+void LatentIndex::search(const Matrix &Q, int k, int nprobe, IdMatrix &ids, Matrix &scores) const
+{
+   THROWERROR_ASSERT_MSG(Q.cols() == nlatent(), "Queries have " + std::to_string(Q.cols()) + " latents, index has " + std::to_string(nlatent()));
+   THROWERROR_ASSERT(k >= 0);
+
+   ids.setConstant(Q.rows(), k, -1);
+   scores.setConstant(Q.rows(), k, std::numeric_limits<float_type>::quiet_NaN());
+
+   #pragma omp parallel for schedule(dynamic, 16)
+   for (Eigen::Index i = 0; i < Q.rows(); ++i)
+   {
+      std::vector<int> row_ids;
+      std::vector<float_type> row_scores;
+      search(Q.row(i), k, nprobe, row_ids, row_scores);
+      for (std::size_t j = 0; j < row_ids.size(); ++j)
+      {
+         ids(i, j) = row_ids[j];
+         scores(i, j) = row_scores[j];
+      }
+   }
+}
+
+double LatentIndex::recall(const Matrix &Q, int k, int nprobe) const
+{
+   IdMatrix approx, exact;
+   Matrix approx_scores, exact_scores;
+   search(Q, k, nprobe, approx, approx_scores);
+   search(Q, k, nlist(), exact, exact_scores);
+
+   std::size_t found = 0, total = 0;
+   for (Eigen::Index i = 0; i < Q.rows(); ++i)
+   {
+      for (int j = 0; j < k && exact(i, j) >= 0; ++j)
+      {
+         total++;
+         for (int a = 0; a < k; ++a)
+            if (approx(i, a) == exact(i, j))
+               found++;
+      }
+   }
+
+   return total ? double(found) / total : 1.0;
+}
+
+void LatentIndex::save(HDF5Group &group) const
+{
+   group.put(OPTIONS_TAG, METRIC_TAG, indexMetricToString(m_metric));
+   group.put(OPTIONS_TAG, ISAMPLE_TAG, (int)m_isample);
+   group.put(OPTIONS_TAG, NPROBE_TAG, m_nprobe);
+   group.put(OPTIONS_TAG, RECALL_TAG, m_recall);
+
+   group.write(LISTS_TAG, CENTROIDS_TAG, m_centroids);
+   group.write(LISTS_TAG, OFFSETS_TAG, IdMatrix(Eigen::Map<const IdMatrix>(m_offsets.data(), m_offsets.size(), 1)));
+   group.write(LISTS_TAG, IDS_TAG, IdMatrix(Eigen::Map<const IdMatrix>(m_ids.data(), m_ids.size(), 1)));
+   group.write(LISTS_TAG, VECTORS_TAG, m_vectors);
+}
+
+void LatentIndex::restore(const HDF5Group &group)
+{
+   m_metric = stringToIndexMetric(group.get(OPTIONS_TAG, METRIC_TAG, indexMetricToString(IndexMetric::inner_product)));
+   m_isample = group.get(OPTIONS_TAG, ISAMPLE_TAG, -1);
+   m_nprobe = group.get(OPTIONS_TAG, NPROBE_TAG, 1);
+   m_recall = group.get(OPTIONS_TAG, RECALL_TAG, (double)NAN);
+
+   IdMatrix offsets, ids;
+   group.read(LISTS_TAG, CENTROIDS_TAG, m_centroids);
+   group.read(LISTS_TAG, OFFSETS_TAG, offsets);
+   group.read(LISTS_TAG, IDS_TAG, ids);
+   group.read(LISTS_TAG, VECTORS_TAG, m_vectors);
+
+   m_offsets.assign(offsets.data(), offsets.data() + offsets.size());
+   m_ids.assign(ids.data(), ids.data() + ids.size());
+
+   THROWERROR_ASSERT_MSG((int)m_offsets.size() == nlist() + 1 && m_offsets.back() == size() && m_vectors.rows() == size(),
+                         "Inconsistent index in " + group.getFileName());
+}
+
+std::ostream &LatentIndex::info(std::ostream &os, std::string indent) const
+{
+   os << indent << "LatentIndex {\n";
+   os << indent << "  metric: " << indexMetricToString(m_metric) << "\n";
+   os << indent << "  size: " << size() << " x " << nlatent() << "\n";
+   os << indent << "  lists: " << nlist() << ", probed per query: " << m_nprobe << "\n";
+   os << indent << "  recall@" << RECALL_K << ": " << m_recall << "\n";
+   if (m_isample >= 0)
+      os << indent << "  built from sample: " << m_isample << "\n";
+   os << indent << "}\n";
+   return os;
+}
+
+}
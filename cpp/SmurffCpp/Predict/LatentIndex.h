@@ -0,0 +1,85 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <SmurffCpp/Types.h>
+
+namespace smurff {
+
+class HDF5Group;
+
+enum class IndexMetric
+{
+   inner_product, // best items for a user: largest U_user . V_item
+   cosine         // most similar items: largest cosine between the vectors
+};
+
+IndexMetric stringToIndexMetric(std::string name);
+std::string indexMetricToString(IndexMetric type);
+
+// Approximate nearest-neighbour index (IVF-flat) over the rows of a latent matrix.
+//
+// The rows are clustered with k-means into nlist lists. A query scores the
+// centroids, then only the vectors in the nprobe best lists, so it reads about
+// nprobe / nlist of the rows; nprobe >= nlist is exact search.
+class LatentIndex
+{
+public:
+   typedef Eigen::Matrix<int, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> IdMatrix;
+
+   static const int DEFAULT_ITERATIONS = 10;
+   static const int RECALL_QUERIES = 100; // rows used as queries to measure recall
+   static const int RECALL_K = 10;
+
+private:
+   IndexMetric m_metric;
+   std::int32_t m_isample; // sample the index was built from, -1 if unknown
+
+   Matrix m_centroids;         // nlist x nlatent
+   std::vector<int> m_offsets; // list l holds m_ids[m_offsets[l] .. m_offsets[l + 1])
+   std::vector<int> m_ids;     // row ids, in list order
+   Matrix m_vectors;           // the rows, in list order; unit length for cosine
+
+   int m_nprobe;    // default lists per query
+   double m_recall; // recall of the top RECALL_K at m_nprobe, see measureRecall
+
+public:
+   LatentIndex();
+
+   // index over the rows of X, nlist defaults to about sqrt(rows); nprobe is the default for search
+   LatentIndex(const Matrix &X, IndexMetric metric, int nlist = 0, int nprobe = 0,
+               int iterations = DEFAULT_ITERATIONS, std::int32_t isample = -1);
+
+public:
+   int size() const { return m_ids.size(); }
+   int nlatent() const { return m_vectors.cols(); }
+   int nlist() const { return m_centroids.rows(); }
+   int getNProbe() const { return m_nprobe; }
+   double getRecall() const { return m_recall; }
+   IndexMetric getMetric() const { return m_metric; }
+   std::int32_t getIsample() const { return m_isample; }
+
+public:
+   // the k best rows for query q, best first, scanning nprobe lists (0: the default)
+   void search(const Vector &q, int k, int nprobe, std::vector<int> &ids, std::vector<float_type> &scores) const;
+
+   // search for each row of Q: row i of ids and scores, -1 and NaN where fewer than k rows
+   void search(const Matrix &Q, int k, int nprobe, IdMatrix &ids, Matrix &scores) const;
+
+   // fraction of the exact top k of each row of Q that search with nprobe lists finds
+   double recall(const Matrix &Q, int k, int nprobe) const;
+
+   // sets getRecall from up to RECALL_QUERIES rows of Q, spread evenly; at build
+   // the indexed rows are the queries, which suits cosine but not inner_product
+   void measureRecall(const Matrix &Q);
+
+public:
+   void save(HDF5Group &) const;
+   void restore(const HDF5Group &);
+
+   std::ostream &info(std::ostream &os, std::string indent) const;
+};
+
+}
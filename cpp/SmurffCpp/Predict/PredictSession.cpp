@@ -1,4 +1,9 @@
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
 #include <memory>
+#include <numeric>
 
 #include <SmurffCpp/Types.h>
 #include <SmurffCpp/Types.h>
@@ -6,6 +11,7 @@
 #include <SmurffCpp/Utils/counters.h>
 #include <SmurffCpp/Utils/StateFile.h>
 #include <SmurffCpp/Utils/MatrixUtils.h>
+#include <SmurffCpp/Utils/TopK.hpp>
 #include <SmurffCpp/result.h>
 #include <SmurffCpp/ResultItem.h>
 
@@ -16,6 +22,47 @@
 namespace smurff
 {
 
+// one model being scored, one being restored
+static const std::size_t PREFETCH_BUFFERS = 2;
+
+// items of a summary prediction that are also averaged over all samples, to report the error
+static const std::size_t SUMMARY_CHECK_ITEMS = 1000;
+
+// recommend scores tiles of rows x items of one sample at once
+static const int RECOMMEND_ROW_TILE = 32;
+static const int RECOMMEND_ITEM_TILE = 256;
+
+// rows x items scores accumulated over the samples per block of items (mean and M2 in double: 64 MB)
+static const std::size_t RECOMMEND_BLOCK_SCORES = std::size_t(1) << 22;
+
+// latent vectors of one sample used to score one block of items
+struct RecommendBlock
+{
+    Matrix U; // the scored rows
+    Matrix V; // the items of the block
+};
+
+// loads the scored rows and items c0 .. c0 + nc - 1 of sample s
+typedef std::function<void(std::size_t s, int c0, int nc, RecommendBlock &)> RecommendLoader;
+
+// rows are positions in RecommendBlock::U; samples are read once per block of block_items
+// items, or of as many items as RECOMMEND_BLOCK_SCORES allows if block_items <= 0
+static Recommendations recommend(std::size_t nsamples, const std::vector<int> &rows, int nitems, int k,
+                                 const std::vector<std::vector<int>> &exclude, double ucb, int block_items,
+                                 const RecommendLoader &load);
+
+// sorted unique rows, and the position of each row in them
+static void unique_rows(const std::vector<int> &rows, std::vector<int> &used, std::vector<int> &pos)
+{
+    used = rows;
+    std::sort(used.begin(), used.end());
+    used.erase(std::unique(used.begin(), used.end()), used.end());
+
+    pos.resize(rows.size());
+    for (std::size_t i = 0; i < rows.size(); ++i)
+        pos[i] = std::lower_bound(used.begin(), used.end(), rows[i]) - used.begin();
+}
+
 PredictSession::PredictSession(const std::string &model_file)
     : ISession(Config()) //FIXME
     , m_model_file(StateFile(model_file))
@@ -30,7 +77,7 @@ PredictSession::PredictSession(const std::string &model_file)
 PredictSession::PredictSession(const Config &config)
     : ISession(config)
     , m_model_file(StateFile(config.getRestoreName()))
-    , m_pred_savefile(std::make_unique<StateFile>(config.getSaveName()))
+    , m_pred_savefile() // created by init() when predictions are saved
     , m_has_config(true)
     , m_num_latent(-1)
     , m_dims(PVec<>(0))
@@ -78,6 +125,7 @@ void PredictSession::init()
     THROWERROR_ASSERT(m_has_config);
     THROWERROR_ASSERT(getConfig().getTest().hasData());
     m_result = Result(getConfig().getTest(), getConfig().getNSamples());
+    used_rows(m_result, m_rows, m_coords);
 
     m_pos = m_stepfiles.rbegin();
     m_iter = 0;
@@ -94,6 +142,15 @@ void PredictSession::init()
 
     if (getConfig().getVerbose())
         info(std::cout, "");
+
+    if (getConfig().getPredictMode() == PredictModes::summary)
+        return;
+
+    // restores the samples in the order of m_pos, while step scores the previous one
+    m_loader = std::make_unique<Prefetcher<Model>>(PREFETCH_BUFFERS, m_stepfiles.size(), [this](std::size_t i, Model &model) {
+        std::lock_guard<std::mutex> lock(m_h5_mutex);
+        model.restore(m_stepfiles.at(m_stepfiles.size() - 1 - i), m_rows);
+    });
 }
 
 bool PredictSession::step()
@@ -102,10 +159,33 @@ bool PredictSession::step()
     THROWERROR_ASSERT(m_is_init);
     THROWERROR_ASSERT(m_pos != m_stepfiles.rend());
 
+    if (getConfig().getPredictMode() == PredictModes::summary)
+    {
+        // one step, from the aggregates of the last sample
+        double start = tick();
+        predictSummary(m_result);
+        double stop = tick();
+        m_iter++;
+        m_secs_per_iter = stop - start;
+        m_secs_total += m_secs_per_iter;
+
+        if (getConfig().getVerbose())
+        {
+            std::cout << getStatus().asString() << std::endl;
+            std::cout << "Summary vs. average over all samples (" << m_summary_error.items << " items): "
+                      << "mean RMSE " << m_summary_error.mean_rmse << ", stddev RMSE " << m_summary_error.std_rmse << std::endl;
+        }
+
+        if (getConfig().getSaveFreq() != 0)
+            save();
+
+        return false;
+    }
+
     double start = tick();
-    Model model;
-    restoreModel(model, *m_pos);
-    m_result.update(model, false);
+    const Model &model = m_loader->next();
+    checkModel(model);
+    m_result.update(model, false, m_coords);
     double stop = tick();
     m_iter++;
     m_secs_per_iter = stop - start;
@@ -131,6 +211,8 @@ bool PredictSession::step()
 
 void PredictSession::save()
 {
+    std::lock_guard<std::mutex> lock(m_h5_mutex);
+
     //save this iteration
     SaveState saveState = m_pred_savefile->createSampleStep(m_iter, false);
 
@@ -176,8 +258,16 @@ std::ostream &PredictSession::info(std::ostream &os, std::string indent) const
     os << indent << "    num-samples: " << getNumSteps() << "\n";
     os << indent << "    num-latent: " << getNumLatent() << "\n";
     os << indent << "    dimensions: " << getModelDims() << "\n";
+    if (m_rows.size())
+    {
+        os << indent << "    rows read per sample:";
+        for (const auto &r : m_rows)
+            os << " " << r.size();
+        os << "\n";
+    }
     os << indent << "  }\n";
     os << indent << "  Predictions {\n";
+    os << indent << "    Predict mode: " << getConfig().getPredictModeAsString() << "\n";
     m_result.info(os, indent + "    ");
     if (getConfig().getSaveFreq() > 0)
     {
@@ -201,7 +291,17 @@ std::ostream &PredictSession::info(std::ostream &os, std::string indent) const
 void PredictSession::restoreModel(Model &model, const SaveState &sf, int skip_mode)
 {
     model.restore(sf, skip_mode);
+    checkModel(model);
+}
 
+void PredictSession::restoreModel(Model &model, const SaveState &sf, const std::vector<std::vector<int>> &rows)
+{
+    model.restore(sf, rows);
+    checkModel(model);
+}
+
+void PredictSession::checkModel(const Model &model)
+{
     if (m_num_latent <= 0)
     {
         m_num_latent = model.nlatent();
@@ -221,6 +321,20 @@ void PredictSession::restoreModel(Model &model, int i, int skip_mode)
     restoreModel(model, m_stepfiles.at(i), skip_mode);
 }
 
+bool PredictSession::getPostMuLambda(int mode, Matrix &mu, AggrMatrix &Lambda) const
+{
+    for (auto it = m_stepfiles.rbegin(); it != m_stepfiles.rend(); ++it)
+    {
+        if (it->hasPostMuLambda(mode))
+        {
+            it->readPostMuLambda(mode, mu, Lambda);
+            return true;
+        }
+    }
+
+    return false;
+}
+
 // predict one element
 ResultItem PredictSession::predict(PVec<> pos, const SaveState &sf)
 {
@@ -259,16 +373,369 @@ std::shared_ptr<Result> PredictSession::predict(const DataConfig &Y)
 {
     auto res = std::make_shared<Result>(Y, getNumSteps());
 
-    for (const auto &s : m_stepfiles)
+    std::vector<std::vector<int>> rows;
+    std::vector<PVec<>> coords;
+    used_rows(*res, rows, coords);
+
+    Prefetcher<Model> loader(PREFETCH_BUFFERS, m_stepfiles.size(), [this, &rows](std::size_t i, Model &model) {
+        std::lock_guard<std::mutex> lock(m_h5_mutex);
+        model.restore(m_stepfiles.at(i), rows);
+    });
+
+    for (std::size_t i = 0; i < loader.count(); ++i)
+    {
+        const Model &model = loader.next();
+        checkModel(model);
+        res->update(model, false, coords);
+    }
+
+    return res;
+}
+
+Recommendations PredictSession::recommend(const std::vector<int> &rows, int k, const std::vector<std::vector<int>> &exclude, double ucb, int mode)
+{
+    THROWERROR_ASSERT_MSG(getNumSteps() > 0, "No samples in " + m_model_file.getPath());
+    THROWERROR_ASSERT_MSG(mode == 0 || mode == 1, "Invalid mode " + std::to_string(mode));
+
+    // only the requested rows of each sample, and one block of items at a time
+    std::vector<int> used, pos;
+    unique_rows(rows, used, pos);
+
+    int nitems;
+    {
+        std::lock_guard<std::mutex> lock(m_h5_mutex);
+        const SaveState &first = m_stepfiles.front();
+        THROWERROR_ASSERT_MSG(first.getNModes() == 2, "recommend needs a model with two modes");
+
+        Matrix none;
+        const int nrows = first.readModel(mode, std::vector<int>(), none);
+        THROWERROR_ASSERT_MSG(used.empty() || (used.front() >= 0 && used.back() < nrows),
+                              "Rows out of range, mode " + std::to_string(mode) + " has " + std::to_string(nrows) + " rows");
+        nitems = first.readModel(1 - mode, std::vector<int>(), none);
+    }
+
+    return smurff::recommend(getNumSteps(), pos, nitems, k, exclude, ucb, 0, [this, &used, mode](std::size_t s, int c0, int nc, RecommendBlock &block) {
+        std::vector<int> items(nc);
+        std::iota(items.begin(), items.end(), c0);
+
+        std::lock_guard<std::mutex> lock(m_h5_mutex);
+        const SaveState &sf = m_stepfiles.at(s);
+        sf.readModel(mode, used, block.U);
+        const int n = sf.readModel(1 - mode, items, block.V);
+        THROWERROR_ASSERT_MSG(n >= c0 + nc, "Samples of " + m_model_file.getPath() + " differ in size");
+    });
+}
+
+LatentIndex PredictSession::getIndex(int mode, IndexMetric metric, int nlist, int nprobe)
+{
+    THROWERROR_ASSERT_MSG(getNumSteps() > 0, "No samples in " + m_model_file.getPath());
+    const SaveState &last = m_stepfiles.back();
+    const int nmodes = last.getNModes();
+    THROWERROR_ASSERT_MSG(mode >= 0 && mode < nmodes, "Invalid mode " + std::to_string(mode));
+
+    std::lock_guard<std::mutex> lock(m_h5_mutex);
+
+    LatentIndex index;
+    if (m_model_file.hasIndex(mode))
+    {
+        m_model_file.restoreIndex(mode, index);
+        if (index.getIsample() == last.getIsample() && index.getMetric() == metric &&
+            (nlist <= 0 || index.nlist() == nlist) && (nprobe <= 0 || index.getNProbe() == nprobe))
+            return index;
+    }
+
+    index = LatentIndex(sampleMean(mode), metric, nlist, nprobe, LatentIndex::DEFAULT_ITERATIONS, last.getIsample());
+
+    // inner_product ranks the rows for vectors of the other mode (e.g. items for users),
+    // so recall is measured with those as queries
+    if (metric == IndexMetric::inner_product && nmodes == 2)
+    {
+        Matrix none;
+        const int n = last.readModel(1 - mode, std::vector<int>(), none);
+        const int nqueries = std::min(LatentIndex::RECALL_QUERIES, n);
+        std::vector<int> queries(nqueries);
+        for (int i = 0; i < nqueries; ++i)
+            queries[i] = static_cast<std::int64_t>(i) * n / nqueries;
+
+        index.measureRecall(sampleMean(1 - mode, queries));
+    }
+
+    m_model_file.saveIndex(mode, index);
+
+    if (getConfig().getVerbose())
+        index.info(std::cout, "");
+
+    return index;
+}
+
+Matrix PredictSession::sampleMean(int mode, const std::vector<int> &rows) const
+{
+    Matrix mean, U;
+    for (std::size_t i = 0; i < m_stepfiles.size(); ++i)
     {
-        Model model;
-        restoreModel(model, s);
-        res->update(model, false);
+        if (rows.empty())
+            m_stepfiles[i].readModel(mode, U);
+        else
+            m_stepfiles[i].readModel(mode, rows, U);
+
+        if (i == 0)
+            mean = U;
+        else
+        {
+            THROWERROR_ASSERT_MSG(U.rows() == mean.rows() && U.cols() == mean.cols(),
+                                  "Samples of " + m_model_file.getPath() + " differ in size");
+            mean += U;
+        }
     }
 
+    return mean / getNumSteps();
+}
+
+SaveState PredictSession::summaryStep() const
+{
+    // samples are saved without aggregates, checkpoints with them (see Model::save)
+    THROWERROR_ASSERT_MSG(m_model_file.hasCheckpoint(),
+                          "No checkpoint in " + m_model_file.getPath() + ": summary predictions need the posterior aggregates, "
+                          "saved with checkpoints (train with --checkpoint-freq)");
+
+    SaveState checkpoint = m_model_file.openCheckpoint();
+    for (unsigned m = 0; m < checkpoint.getNModes(); ++m)
+        THROWERROR_ASSERT_MSG(checkpoint.hasAggr(m), "No posterior aggregates for mode " + std::to_string(m) +
+                              " in " + checkpoint.getName() + " of " + m_model_file.getPath());
+
+    return checkpoint;
+}
+
+void PredictSession::predictSummary(Result &res)
+{
+    Model model;
+    {
+        std::lock_guard<std::mutex> lock(m_h5_mutex);
+        restoreModel(model, summaryStep());
+    }
+
+    res.updateSummary(model);
+    m_summary_error = checkSummary(res);
+}
+
+std::shared_ptr<Result> PredictSession::predictSummary(const DataConfig &Y)
+{
+    auto res = std::make_shared<Result>(Y, getNumSteps());
+    predictSummary(*res);
     return res;
 }
 
+SummaryError PredictSession::checkSummary(const Result &summary)
+{
+    SummaryError err;
+    const auto &items = summary.m_predictions;
+    const std::size_t n = std::min(SUMMARY_CHECK_ITEMS, items.size());
+    if (n == 0)
+        return err;
+
+    // items spread evenly over the result
+    auto item = [&items, n](std::size_t i) -> const ResultItem & { return items[i * items.size() / n]; };
+
+    Result check;
+    check.m_dims = summary.m_dims;
+    check.m_nsamples = getNumSteps();
+    for (std::size_t i = 0; i < n; ++i)
+        check.m_predictions.push_back(ResultItem(item(i).coords, item(i).val, getNumSteps()));
+
+    std::vector<std::vector<int>> rows;
+    std::vector<PVec<>> coords;
+    used_rows(check, rows, coords);
+
+    Prefetcher<Model> loader(PREFETCH_BUFFERS, m_stepfiles.size(), [this, &rows](std::size_t i, Model &model) {
+        std::lock_guard<std::mutex> lock(m_h5_mutex);
+        model.restore(m_stepfiles.at(i), rows);
+    });
+
+    for (std::size_t i = 0; i < loader.count(); ++i)
+        check.update(loader.next(), false, coords);
+
+    // standard deviations over the samples, var being a sum of squares (see ResultItem::update)
+    double se_mean = 0.0, se_std = 0.0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const auto &s = item(i);
+        const auto &c = check.m_predictions[i];
+        se_mean += std::pow(s.pred_avg - c.pred_avg, 2);
+        se_std += std::pow(std::sqrt(s.var / s.nsamples) - std::sqrt(c.var / c.nsamples), 2);
+    }
+
+    err.items = n;
+    err.mean_rmse = std::sqrt(se_mean / n);
+    err.std_rmse = std::sqrt(se_std / n);
+    return err;
+}
+
+void used_rows(const Result &result, std::vector<std::vector<int>> &rows, std::vector<PVec<>> &coords)
+{
+    const auto &items = result.m_predictions;
+    const std::size_t nmodes = items.empty() ? result.m_dims.size() : items.front().coords.size();
+
+    rows.assign(nmodes, std::vector<int>());
+    for (const auto &item : items)
+        for (std::size_t m = 0; m < nmodes; ++m)
+            rows[m].push_back(item.coords[m]);
+
+    for (auto &r : rows)
+    {
+        std::sort(r.begin(), r.end());
+        r.erase(std::unique(r.begin(), r.end()), r.end());
+    }
+
+    coords.resize(items.size());
+    #pragma omp parallel for schedule(static)
+    for (std::size_t k = 0; k < items.size(); ++k)
+    {
+        PVec<> pos(nmodes);
+        for (std::size_t m = 0; m < nmodes; ++m)
+            pos[m] = std::lower_bound(rows[m].begin(), rows[m].end(), items[k].coords[m]) - rows[m].begin();
+        coords[k] = pos;
+    }
+}
+
+Recommendations recommend(const std::vector<Model> &models, int mode, const std::vector<int> &rows, int k,
+                          const std::vector<std::vector<int>> &exclude, double ucb, int block_items)
+{
+    THROWERROR_ASSERT(!models.empty());
+
+    const int nitems = models.front().U(1 - mode).rows();
+    const int nlatent = models.front().nlatent();
+    for (const auto &model : models)
+        THROWERROR_ASSERT(model.U(1 - mode).rows() == nitems && model.nlatent() == nlatent);
+    for (int r : rows)
+        THROWERROR_ASSERT(r >= 0 && r < models.front().U(mode).rows());
+
+    std::vector<int> used, pos;
+    unique_rows(rows, used, pos);
+
+    return recommend(models.size(), pos, nitems, k, exclude, ucb, block_items, [&models, &used, mode](std::size_t s, int c0, int nc, RecommendBlock &block) {
+        const Matrix &U = models.at(s).U(mode);
+        block.U.resize(used.size(), U.cols());
+        for (std::size_t i = 0; i < used.size(); ++i)
+            block.U.row(i) = U.row(used[i]);
+        block.V = models.at(s).U(1 - mode).middleRows(c0, nc);
+    });
+}
+
+static Recommendations recommend(std::size_t nsamples, const std::vector<int> &rows, int nitems, int k,
+                                 const std::vector<std::vector<int>> &exclude, double ucb, int block_items,
+                                 const RecommendLoader &load)
+{
+    THROWERROR_ASSERT(nsamples > 0);
+    THROWERROR_ASSERT(k >= 0);
+    THROWERROR_ASSERT_MSG(exclude.empty() || exclude.size() == rows.size(), "Need one exclusion list per row");
+
+    const int nrows = rows.size();
+
+    Recommendations ret;
+    ret.items.setConstant(nrows, k, -1);
+    ret.scores.setConstant(nrows, k, std::numeric_limits<float_type>::quiet_NaN());
+    if (nrows == 0 || nitems == 0)
+        return ret;
+
+    // as many items per block as the accumulators allow, at least one item tile
+    if (block_items <= 0)
+        block_items = std::max<std::size_t>(RECOMMEND_ITEM_TILE, RECOMMEND_BLOCK_SCORES / nrows);
+    block_items = std::min(block_items, nitems);
+    const int row_tiles = (nrows + RECOMMEND_ROW_TILE - 1) / RECOMMEND_ROW_TILE;
+
+    // sorted exclusion lists, and the next excluded item of each row
+    std::vector<std::vector<int>> excluded(nrows);
+    std::vector<std::size_t> next_excluded(nrows, 0);
+    if (!exclude.empty())
+    {
+        #pragma omp parallel for schedule(static)
+        for (int i = 0; i < nrows; ++i)
+        {
+            excluded[i] = exclude[i];
+            std::sort(excluded[i].begin(), excluded[i].end());
+        }
+    }
+
+    std::vector<TopK> best(nrows, TopK(k));
+
+    // running mean and sum of squared deviations over the samples, as in ResultItem::update
+    Eigen::Array<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> mean(nrows, block_items), m2(nrows, block_items);
+
+    for (int c0 = 0; c0 < nitems; c0 += block_items)
+    {
+        const int nc = std::min(block_items, nitems - c0);
+        const int item_tiles = (nc + RECOMMEND_ITEM_TILE - 1) / RECOMMEND_ITEM_TILE;
+        mean.leftCols(nc).setZero();
+        m2.leftCols(nc).setZero();
+
+        Prefetcher<RecommendBlock> loader(PREFETCH_BUFFERS, nsamples, [&load, c0, nc](std::size_t s, RecommendBlock &block) {
+            load(s, c0, nc, block);
+        });
+
+        for (std::size_t s = 0; s < nsamples; ++s)
+        {
+            const RecommendBlock &block = loader.next();
+            THROWERROR_ASSERT(block.V.rows() == nc && block.U.cols() == block.V.cols());
+
+            #pragma omp parallel
+            {
+                Matrix U, P;
+                Eigen::Array<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> delta;
+
+                #pragma omp for schedule(dynamic, 1)
+                for (int t = 0; t < row_tiles * item_tiles; ++t)
+                {
+                    const int r0 = (t / item_tiles) * RECOMMEND_ROW_TILE;
+                    const int nr = std::min(RECOMMEND_ROW_TILE, nrows - r0);
+                    const int j0 = (t % item_tiles) * RECOMMEND_ITEM_TILE;
+                    const int nj = std::min(RECOMMEND_ITEM_TILE, nc - j0);
+
+                    U.resize(nr, block.U.cols());
+                    for (int i = 0; i < nr; ++i)
+                        U.row(i) = block.U.row(rows[r0 + i]);
+
+                    P.noalias() = U * block.V.middleRows(j0, nj).transpose();
+                    auto mt = mean.block(r0, j0, nr, nj);
+                    auto m2t = m2.block(r0, j0, nr, nj);
+                    delta = P.array().cast<double>() - mt;
+                    mt += delta / double(s + 1);
+                    m2t += delta * (P.array().cast<double>() - mt);
+                }
+            }
+        }
+
+        #pragma omp parallel for schedule(static)
+        for (int i = 0; i < nrows; ++i)
+        {
+            auto &ex = excluded[i];
+            auto &e = next_excluded[i];
+            for (int j = 0; j < nc; ++j)
+            {
+                const int item = c0 + j;
+                while (e < ex.size() && ex[e] < item)
+                    ++e;
+                if (e < ex.size() && ex[e] == item)
+                    continue;
+
+                const double var = nsamples > 1 ? m2(i, j) / (nsamples - 1) : 0.0;
+                best[i].push(mean(i, j) + ucb * std::sqrt(std::max(var, 0.0)), item);
+            }
+        }
+    }
+
+    for (int i = 0; i < nrows; ++i)
+    {
+        const auto &heap = best[i].sorted();
+        for (std::size_t j = 0; j < heap.size(); ++j)
+        {
+            ret.scores(i, j) = heap[j].first;
+            ret.items(i, j) = heap[j].second;
+        }
+    }
+
+    return ret;
+}
+
 SparseMatrix predict_matrix(const SparseMatrix &coords, const std::vector<Matrix> &latents)
 {
     THROWERROR_ASSERT(latents.size() == 2);
@@ -1,12 +1,15 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 
 #include <SmurffCpp/Types.h>
 #include <SmurffCpp/Types.h>
 
 #include <SmurffCpp/Utils/PVec.hpp>
 #include <SmurffCpp/Utils/StateFile.h>
+#include <SmurffCpp/Utils/Prefetcher.hpp>
+#include <SmurffCpp/Predict/LatentIndex.h>
 #include <SmurffCpp/Sessions/ISession.h>
 #include <SmurffCpp/Model.h>
 #include <SmurffCpp/result.h>
@@ -17,6 +20,23 @@ namespace smurff {
 class Result;
 struct ResultItem;
 
+// summary predictions against the average over all samples, see PredictSession::checkSummary
+struct SummaryError
+{
+    std::size_t items = 0;  // items compared
+    double mean_rmse = NAN; // RMSE of the predictive mean
+    double std_rmse = NAN;  // RMSE of the predictive standard deviation
+};
+
+// best items of each row, see PredictSession::recommend
+struct Recommendations
+{
+    // row i: items(i, j) with score scores(i, j), best first; -1 and NaN
+    // where a row has fewer than k candidates
+    Eigen::Matrix<int, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> items;
+    Matrix scores;
+};
+
 class PredictSession : public ISession
 {
     friend SparseMatrix predict(const SparseMatrix &coords, const Matrix &U, const Matrix &V);
@@ -38,15 +58,31 @@ private:
     int m_num_latent;
     PVec<> m_dims;
 
+    // rows of the model used by the test items, and their coordinates in those rows
+    std::vector<std::vector<int>> m_rows;
+    std::vector<PVec<>> m_coords;
+
+    // samples restored ahead of step, in the order of m_pos
+    std::mutex m_h5_mutex; // HDF5 is not thread-safe: loader and save take turns
+    std::unique_ptr<Prefetcher<Model>> m_loader;
+
+    SummaryError m_summary_error;
+
 public:
     void restoreModel(Model &, const SaveState &, int skip_mode = -1);
     void restoreModel(Model &, int i, int skip_mode = -1);
+    // only the given rows of each mode, see Model::restore
+    void restoreModel(Model &, const SaveState &, const std::vector<std::vector<int>> &rows);
 
 public:
     int    getNumSteps()  const { return m_stepfiles.size(); } 
     int    getNumLatent() const { return m_num_latent; } 
     PVec<> getModelDims() const { return m_dims; } 
 
+    // posterior mean and precision of each row in mode `mode`, from the last
+    // sample that has them; Lambda is packed (see Utils/PackedSymmetric.hpp)
+    bool getPostMuLambda(int mode, Matrix &mu, AggrMatrix &Lambda) const;
+
 public:
     // ISession interface 
     void run() override;
@@ -58,6 +94,14 @@ public:
 
 private:
     void save();
+    void checkModel(const Model &);
+
+    // the last checkpoint, which holds the posterior aggregates of all modes
+    SaveState summaryStep() const;
+
+    // average over all samples of rows (all if empty) of mode `mode`; the caller holds m_h5_mutex
+    Matrix sampleMean(int mode, const std::vector<int> &rows = {}) const;
+    void predictSummary(Result &);
 
   public:
     PredictSession(const std::string &model_file);
@@ -81,6 +125,26 @@ private:
     // predict element or elements based on sideinfo
     template <class Feat>
     std::shared_ptr<Matrix> predict(int mode, const Feat &f, int save_freq = 0);
+
+    // predict all elements in Y in one pass from the posterior aggregates, see Result::updateSummary
+    std::shared_ptr<Result> predictSummary(const DataConfig &Y);
+
+    // summary predictions of result against the average over all samples, on up to
+    // SUMMARY_CHECK_ITEMS of its items (reading only their rows of each sample)
+    SummaryError checkSummary(const Result &);
+    const SummaryError &getSummaryError() const { return m_summary_error; }
+
+    // the k best items of the other mode for each of rows (ids in mode `mode`) of a
+    // two-mode model, scored over all samples by posterior mean + ucb * standard deviation;
+    // exclude, if not empty, lists the items never recommended to each row (e.g. already rated);
+    // items are scored in blocks, reading only the rows and the block's items of each sample
+    Recommendations recommend(const std::vector<int> &rows, int k,
+                              const std::vector<std::vector<int>> &exclude = {}, double ucb = 0.0, int mode = 0);
+
+    // approximate nearest-neighbour index over the posterior mean of mode `mode`, the average
+    // over all samples; restored from the model file when saved there for the last sample with
+    // the same settings, else built and saved there (one index per mode)
+    LatentIndex getIndex(int mode, IndexMetric metric, int nlist = 0, int nprobe = 0);
 };
 
 // predict element or elements based on sideinfo
@@ -131,6 +195,15 @@ std::shared_ptr<Matrix> PredictSession::predict(int mode, const Feat &f, int sav
     return average;
 }
 
+// sorted rows of each mode that the items of result use, and the coordinates
+// of each item in a model restored with only these rows
+void used_rows(const Result &, std::vector<std::vector<int>> &rows, std::vector<PVec<>> &coords);
+
+// as PredictSession::recommend, over the given models; rows index U(mode) of the models,
+// block_items (if > 0) is the number of items scored over all samples at once
+Recommendations recommend(const std::vector<Model> &models, int mode, const std::vector<int> &rows, int k,
+                          const std::vector<std::vector<int>> &exclude, double ucb, int block_items = 0);
+
 SparseMatrix predict_matrix(const SparseMatrix &, const std::vector<Matrix> &);
 SparseTensor predict_tensor(const SparseTensor &, const std::vector<Matrix> &);
     
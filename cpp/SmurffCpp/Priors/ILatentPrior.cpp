@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "ILatentPrior.h"
 #include <SmurffCpp/Utils/counters.h>
 
@@ -13,6 +15,8 @@ void ILatentPrior::init()
 {
    rrs.init(Vector::Zero(num_latent()));
    MMs.init(Matrix::Zero(num_latent(), num_latent()));
+   mus.init(Vector::Zero(num_latent()));
+   m_busy.init(0.0);
 
    //this is some new initialization
    init_Usum();
@@ -105,25 +109,93 @@ void ILatentPrior::sample_latents()
    COUNTER("sample_latents");
    data().update_pnm(model(), m_mode);
 
-   #pragma omp parallel for schedule(guided)
-   for (int n = 0; n < U().rows(); n++)
-   #pragma omp task
+   const bool shared = sample_latents_shared();
+   const bool deferred_stats = getConfig().getDeferredStats();
+
+   auto sample_row = [this, shared, deferred_stats](int n)
    {
-      COUNTER("sample_latent");
-      sample_latent(n);
-      const auto &row = U().row(n);
-      Urow.local().noalias() += row;
-      UUrow.local().noalias() += row.transpose() * row;
+      const double start = tick();
+
+      if (!shared)
+      {
+         COUNTER("sample_latent");
+         sample_latent(n);
+      }
+
+      data().update_residuals(model(), m_mode, n);
+
+      if (!deferred_stats)
+      {
+         const auto &row = U().row(n);
+         Urow.local().noalias() += row;
+         UUrow.local().noalias() += row.transpose() * row;
+      }
 
       if (m_session.inSamplingPhase())
          model().updateAggr(m_mode, n);
+
+      m_busy.local() += tick() - start;
+   };
+
+   const auto &order = data().getSampleOrder(m_mode);
+   if (order.empty())
+   {
+      #pragma omp parallel for schedule(guided)
+      for (int n = 0; n < U().rows(); n++)
+      #pragma omp task
+      sample_row(n);
+   }
+   else
+   {
+      // heaviest rows first, one task per row: threads that run out of work
+      // take the remaining tasks, so no thread is left with a tail of heavy rows
+      #pragma omp parallel
+      #pragma omp single
+      for (int n : order)
+      {
+         #pragma omp task
+         sample_row(n);
+      }
    }
 
+   update_load_imbalance();
+
    if (m_session.inSamplingPhase())
       model().updateAggr(m_mode);
 
-   Usum = Urow.combine_and_reset();
-   UUsum = UUrow.combine_and_reset();
+   if (deferred_stats)
+   {
+      // one (multithreaded) GEMM over U instead of a rank-1 update per row
+      COUNTER("deferred_stats");
+      Usum = U().colwise().sum();
+      UUsum.noalias() = U().transpose() * U();
+   }
+   else
+   {
+      Usum = Urow.combine_and_reset();
+      UUsum = UUrow.combine_and_reset();
+   }
+}
+
+bool ILatentPrior::sample_latents_shared()
+{
+   return false;
+}
+
+// max over mean of the time each thread spent sampling rows in the last sweep
+void ILatentPrior::update_load_imbalance()
+{
+   double max_busy = 0.0, sum_busy = 0.0;
+   int nthreads = 0;
+   for (double t : m_busy)
+   {
+      max_busy = std::max(max_busy, t);
+      sum_busy += t;
+      nthreads++;
+   }
+
+   m_load_imbalance = sum_busy > 0.0 ? max_busy * nthreads / sum_busy : 1.0;
+   m_busy.reset();
 }
 
 bool ILatentPrior::save(SaveState &sf) const
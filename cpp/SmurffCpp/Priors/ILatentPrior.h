@@ -29,6 +29,7 @@ public:
 
    thread_vector<Vector> rrs;
    thread_vector<Matrix> MMs;
+   mutable thread_vector<Vector> mus; // for fullMu(n) when it is not mu()
 
 public:
    ILatentPrior(TrainSession &trainSession, uint32_t mode, std::string name = "xxxx");
@@ -64,6 +65,7 @@ public:
    const Vector& getUsum() { return Usum; } 
    const Matrix& getUUsum()  { return UUsum; }
 
+   // with async_save this runs on the writer thread, while sampling goes on
    virtual bool save(SaveState &sf) const;
    virtual void restore(const SaveState &sf);
    virtual std::ostream &info(std::ostream &os, std::string indent);
@@ -75,6 +77,12 @@ public:
    virtual void sample_latents();
    virtual void sample_latent(int n) = 0;
 
+   // samples all rows at once, returns false if not supported
+   virtual bool sample_latents_shared();
+
+   // 1.0 when all threads were equally busy in the last sweep
+   double getLoadImbalance() const { return m_load_imbalance; }
+
    virtual void update_prior() = 0;
 
 private:
@@ -85,6 +93,11 @@ private:
    // for effiency, we keep + update Urow and UUrow by every thread
    thread_vector<Vector> Urow;
    thread_vector<Matrix> UUrow;
+
+   // time spent sampling per thread, for the load imbalance
+   thread_vector<double> m_busy;
+   double m_load_imbalance = 1.0;
+   void update_load_imbalance();
    
 public:
    void setMode(std::uint32_t value)
@@ -34,9 +34,11 @@ void MacauOnePrior::update_prior()
       sample_beta_precision();
 }
 
-const Vector MacauOnePrior::fullMu(int n) const
+const Vector &MacauOnePrior::fullMu(int n) const
 {
-   return mu() + Uhat.row(n);
+   Vector &mu_n = mus.local();
+   mu_n.noalias() = mu() + Uhat.row(n);
+   return mu_n;
 }
 
 void MacauOnePrior::addSideInfo(const std::shared_ptr<ISideInfo>& si, double bp, double tol, bool, bool ebps, bool toce)
@@ -38,7 +38,7 @@ public:
 
    void update_prior() override;
     
-   const Vector fullMu(int n) const override;
+   const Vector &fullMu(int n) const override;
 
    int num_feat() const { return Features->cols(); }
    
@@ -114,9 +114,11 @@ void MacauPrior::sample_beta()
     BtB = beta().transpose() * beta();
 }
 
-const Vector MacauPrior::fullMu(int n) const
+const Vector &MacauPrior::fullMu(int n) const
 {
-   return mu() + Uhat.row(n);
+   Vector &mu_n = mus.local();
+   mu_n.noalias() = mu() + Uhat.row(n);
+   return mu_n;
 }
 
 void MacauPrior::compute_Ft_y(Matrix& Ft_y)
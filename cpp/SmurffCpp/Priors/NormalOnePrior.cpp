@@ -30,7 +30,7 @@ void NormalOnePrior::init()
    df = K;
 }
 
-const Vector NormalOnePrior::fullMu(int n) const
+const Vector &NormalOnePrior::fullMu(int n) const
 {
    return mu();
 }
@@ -44,8 +44,10 @@ void NormalOnePrior::sample_latent(int d)
 {
    const int K = num_latent();
 
-   Matrix XX = Matrix::Zero(K, K);
-   Vector yX = Vector::Zero(K);
+   Matrix &XX = MMs.local();
+   Vector &yX = rrs.local();
+   XX.setZero();
+   yX.setZero();
 
    data().getMuLambda(model(), m_mode, d, yX, XX);
 
@@ -34,7 +34,7 @@ public:
    //mu in NormalPrior does not depend on column index
    //however successors of this class can override this method
    //for example in MacauPrior mu depends on Uhat.row(n)
-   virtual const Vector fullMu(int n) const;
+   virtual const Vector &fullMu(int n) const;
 
    void sample_latent(int n) override;
    virtual std::pair<float_type,float_type> sample_latent(int d, int k, const Matrix& XX, const Vector& yX);
@@ -9,6 +9,7 @@
 
 #include <SmurffCpp/Utils/Distribution.h>
 #include <SmurffCpp/Utils/Error.h>
+#include <SmurffCpp/Utils/FixedKernels.hpp>
 
 namespace smurff {
 
@@ -39,6 +40,15 @@ void NormalPrior::init()
    b0 = 2;
    df = K;
 
+   Workspace ws;
+   ws.Vd.resize(K, K);
+   ws.W.resize(K, K);
+   ws.C.resize(K, K);
+   ws.z.resize(K);
+   ws.x.resize(K);
+   ws.t.resize(K);
+   workspaces.init(ws);
+
    const auto &config = getConfig();
    if (config.hasPropagatedPosterior(getMode()))
    {
@@ -46,17 +56,19 @@ void NormalPrior::init()
    }
 }
 
-const Vector NormalPrior::fullMu(int n) const
+const Vector &NormalPrior::fullMu(int n) const
 {
    if (getConfig().hasPropagatedPosterior(getMode()))
    {
-      return getConfig().getMuPropagatedPosterior(getMode()).getDenseMatrixData().row(n);
+      Vector &mu_n = mus.local();
+      mu_n = getConfig().getMuPropagatedPosterior(getMode()).getDenseMatrixData().row(n);
+      return mu_n;
    }
    //else
    return mu();
 }
 
-const Matrix NormalPrior::getLambda(int n) const
+Eigen::Map<const Matrix> NormalPrior::getLambda(int n) const
 {
    if (getConfig().hasPropagatedPosterior(getMode()))
    {
@@ -64,16 +76,31 @@ const Matrix NormalPrior::getLambda(int n) const
       return Eigen::Map<const Matrix>(Lambda_pp.row(n).data(), num_latent(), num_latent());
    }
    //else
-   return Lambda;
+   return Eigen::Map<const Matrix>(Lambda.data(), num_latent(), num_latent());
 }
 void NormalPrior::update_prior()
 {
    std::tie(mu(), Lambda) = CondNormalWishart(num_item(), getUUsum(), getUsum(), mu0, b0, WI, df);
 }
 
+void NormalPrior::sample_latents()
+{
+   Lambda_llt = Lambda.llt();
+   if(Lambda_llt.info() != Eigen::Success)
+   {
+      THROWERROR("Cholesky Decomposition failed!");
+   }
+   Lambda_inv = Lambda_llt.solve(Matrix::Identity(num_latent(), num_latent()));
+
+   ILatentPrior::sample_latents();
+}
+
 //n is an index of column in U matrix
 void  NormalPrior::sample_latent(int n)
 {
+   if (sample_latent_lowrank(n))
+      return;
+
    const auto &mu_u = fullMu(n);
    const auto &Lambda_u = getLambda(n);
 
@@ -92,21 +119,105 @@ void  NormalPrior::sample_latent(int n)
 
    //Solve system of linear equations for x: MM * x = rr - not exactly correct  because we have random part
    //Sample from multivariate normal distribution with mean rr and precision matrix MM
+   kernels::sample_mvnormal(MM, rr);
+
+   U().row(n).noalias() = rr; // rr is equal to x
+}
+
+// rows with less than num_latent observations have precision Lambda + Vd^T * Vd
+// with Vd of low rank: use the Woodbury identity on Lambda_inv instead of
+// factoring the K x K precision
+bool NormalPrior::sample_latent_lowrank(int n)
+{
+   if (getConfig().hasPropagatedPosterior(getMode()))
+      return false;
+
+   const int K = num_latent();
+   Vector &rr = rrs.local();
+   Workspace &ws = workspaces.local();
+   int d = 0;
+
+   rr.setZero();
+   if (!data().getMuLowRank(model(), m_mode, n, K, rr, ws.Vd, d))
+      return false;
+
+   rr.noalias() += fullMu(n) * Lambda;
+
+   auto Vd = ws.Vd.topRows(d);
+   auto z = ws.z.head(d);
+   auto &x = ws.x;
 
-   Eigen::LLT<Matrix> chol;
+   // noise with covariance Lambda + Vd^T * Vd, so that rr * (Lambda + Vd^T * Vd)^-1 is a sample
+   ws.z = Vector::NullaryExpr(K, RandNormalGenerator());
+   rr.noalias() += ws.z * Lambda_llt.matrixU();
+   z = Vector::NullaryExpr(d, RandNormalGenerator());
+   rr.noalias() += z * Vd;
+
+   // (Lambda + Vd^T * Vd)^-1 = Lambda_inv - W^T * (I + Vd * W^T)^-1 * W, with W = Vd * Lambda_inv
+   x.noalias() = rr * Lambda_inv;
+   if (d > 0)
    {
-      chol = MM.llt(); // compute the Cholesky decomposition X = L * U
-      if(chol.info() != Eigen::Success)
-      {
-         THROWERROR("Cholesky Decomposition failed!");
-      }
+      auto W = ws.W.topRows(d);
+      auto C = ws.C.topLeftCorner(d, d);
+      auto t = ws.t.head(d);
+
+      W.noalias() = Vd * Lambda_inv;
+      C.setIdentity();
+      C.noalias() += W * Vd.transpose();
+
+      t.noalias() = x * Vd.transpose();
+      Eigen::LLT<Eigen::Ref<Matrix>> chol(C); // in place
+      chol.solveInPlace(t.transpose());
+      x.noalias() -= t * W;
    }
 
-   chol.matrixL().solveInPlace(rr.transpose()); // solve for y: y = L^-1 * b
-   rr.noalias() += Vector::NullaryExpr(num_latent(), RandNormalGenerator());
-   chol.matrixU().solveInPlace(rr.transpose()); // solve for x: x = U^-1 * y
-   
-   U().row(n).noalias() = rr; // rr is equal to x
+   U().row(n).noalias() = x;
+   return true;
+}
+
+// when all rows have the same precision matrix MM, factor it once
+// and solve for all rows with one triangular solve on RR
+bool NormalPrior::sample_latents_shared()
+{
+   if (!data().hasSharedPrecision(m_mode) || getConfig().hasPropagatedPosterior(getMode()))
+      return false;
+
+   COUNTER("sample_latents_shared");
+   const int K = num_latent();
+
+   Matrix MM = Lambda;
+   data().getSharedLambda(model(), m_mode, MM);
+
+   Eigen::LLT<Matrix> chol = MM.llt();
+   if(chol.info() != Eigen::Success)
+   {
+      THROWERROR("Cholesky Decomposition failed!");
+   }
+
+   RR.resize(num_item(), K);
+
+   #pragma omp parallel for schedule(guided)
+   for (int n = 0; n < num_item(); n++)
+   {
+      Vector &rr = rrs.local();
+      Vector &z = workspaces.local().z;
+      rr.setZero();
+      data().getMu(model(), m_mode, n, rr);
+      rr.noalias() += fullMu(n) * Lambda;
+
+      // adding L * z here equals adding z after the L solve
+      z = Vector::NullaryExpr(K, RandNormalGenerator());
+      rr.noalias() += z * chol.matrixU();
+
+      RR.row(n) = rr;
+   }
+
+   chol.matrixL().solveInPlace(RR.transpose());
+   chol.matrixU().solveInPlace(RR.transpose());
+
+   U() = RR;
+
+   return true;
 }
 
 std::ostream &NormalPrior::status(std::ostream &os, std::string indent) const
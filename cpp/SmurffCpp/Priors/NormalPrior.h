@@ -28,6 +28,25 @@ public:
   int b0;
   int df;
 
+private:
+  // right-hand sides for all rows, used by sample_latents_shared
+  Matrix RR;
+
+  // factorization and inverse of Lambda, used by sample_latent_lowrank
+  Eigen::LLT<Matrix> Lambda_llt;
+  Matrix Lambda_inv;
+
+  // per-thread temporaries of sample_latent_lowrank and sample_latents_shared,
+  // allocated once in init() as K x K, only the top d rows/cols are used
+  struct Workspace
+  {
+     Matrix Vd, W, C;
+     Vector z, x, t;
+  };
+  thread_vector<Workspace> workspaces;
+
+  bool sample_latent_lowrank(int n);
+
 public:
   NormalPrior(TrainSession &trainSession, uint32_t mode, std::string name = "NormalPrior");
   virtual ~NormalPrior() {}
@@ -36,10 +55,12 @@ public:
   //mu in NormalPrior does not depend on column index
   //however successors of this class can override this method
   //for example in MacauPrior mu depends on Uhat.row(n)
-  virtual const Vector fullMu(int n) const;
-  const Matrix getLambda(int n) const;
+  virtual const Vector &fullMu(int n) const;
+  Eigen::Map<const Matrix> getLambda(int n) const;
   
+  void sample_latents() override;
   void sample_latent(int n) override;
+  bool sample_latents_shared() override;
 
   void update_prior() override;
   std::ostream &status(std::ostream &os, std::string indent) const override;
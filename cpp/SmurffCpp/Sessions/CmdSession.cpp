@@ -19,6 +19,7 @@
 
 #include <SmurffCpp/Utils/StateFile.h>
 #include <SmurffCpp/Utils/StringUtils.h>
+#include <SmurffCpp/Utils/GenericIO.h>
 
 #ifdef ENABLE_TESTS
 #include <Tests/Tests.h>
@@ -44,10 +45,21 @@ static const std::string NUM_THREADS_NAME = "num-threads";
 static const std::string SAVE_NAME = "save-name";
 static const std::string SAVE_FREQ_NAME = "save-freq";
 static const std::string CHECKPOINT_FREQ_NAME = "checkpoint-freq";
+static const std::string SAMPLE_STORAGE_NAME = "sample-storage";
+static const std::string SAMPLE_COMPRESSION_NAME = "sample-compression";
+static const std::string PREDICT_MODE_NAME = "predict-mode";
 static const std::string THRESHOLD_NAME = "threshold";
 static const std::string VERBOSE_NAME = "verbose";
 static const std::string VERSION_NAME = "version";
 static const std::string SEED_NAME = "seed";
+static const std::string GATHER_KERNEL_NAME = "gather-kernel";
+static const std::string RESIDUAL_CACHE_NAME = "residual-cache";
+static const std::string DEFERRED_STATS_NAME = "deferred-stats";
+static const std::string DEGREE_SCHEDULE_NAME = "degree-schedule";
+static const std::string TRANSPOSED_VALUES_NAME = "transposed-values";
+static const std::string MMAP_DATA_NAME = "mmap-data";
+static const std::string EMBED_DATA_NAME = "embed-data";
+static const std::string ASYNC_SAVE_NAME = "async-save";
 
 namespace po = boost::program_options;
 
@@ -63,27 +75,38 @@ po::options_description get_desc()
 
     po::options_description train_desc("Used during training");
     train_desc.add_options()
-	(TRAIN_NAME.c_str(), po::value<std::string>(), "train data file")
+	(TRAIN_NAME.c_str(), po::value<std::string>(), "train data file: .sdm, .sbm, .ddm, .mtx/.mm or .csv")
 	(TEST_NAME.c_str(), po::value<std::string>(), "test data")
 	(PRIOR_NAME.c_str(), po::value<std::vector<std::string>>()->multitoken(), "provide a prior-type for each dimension of train; prior-types:  <normal|normalone|spikeandslab|macau|macauone>")
 	(BURNIN_NAME.c_str(), po::value<int>()->default_value(Config::BURNIN_DEFAULT_VALUE), "number of samples to discard")
 	(NSAMPLES_NAME.c_str(), po::value<int>()->default_value(Config::NSAMPLES_DEFAULT_VALUE), "number of samples to collect")
 	(NUM_LATENT_NAME.c_str(), po::value<int>()->default_value(Config::NUM_LATENT_DEFAULT_VALUE), "number of latent dimensions")
-	(THRESHOLD_NAME.c_str(), po::value<double>()->default_value(Config::THRESHOLD_DEFAULT_VALUE), "threshold for binary classification and AUC calculation");
+	(THRESHOLD_NAME.c_str(), po::value<double>()->default_value(Config::THRESHOLD_DEFAULT_VALUE), "threshold for binary classification and AUC calculation")
+	(GATHER_KERNEL_NAME.c_str(), po::value<bool>()->default_value(Config::GATHER_KERNEL_DEFAULT_VALUE), "use gather + SYRK kernel for data with missing values (0 = rank-1 updates)")
+	(RESIDUAL_CACHE_NAME.c_str(), po::value<bool>()->default_value(Config::RESIDUAL_CACHE_DEFAULT_VALUE), "keep residuals of train data with missing values in memory for the noise update and train RMSE")
+	(DEFERRED_STATS_NAME.c_str(), po::value<bool>()->default_value(Config::DEFERRED_STATS_DEFAULT_VALUE), "compute the sums of U and U^T * U after each sweep instead of per row")
+	(DEGREE_SCHEDULE_NAME.c_str(), po::value<bool>()->default_value(Config::DEGREE_SCHEDULE_DEFAULT_VALUE), "sample rows with most observations first, one task per row")
+	(TRANSPOSED_VALUES_NAME.c_str(), po::value<bool>()->default_value(Config::TRANSPOSED_VALUES_DEFAULT_VALUE), "keep a column-ordered copy of the values of sparse train matrices (faster, more memory)")
+	(MMAP_DATA_NAME.c_str(), po::value<bool>()->default_value(Config::MMAP_DATA_DEFAULT_VALUE), "save sparse train data with its transposed index, so --restore-from maps it from the state file instead of reading it")
+	(EMBED_DATA_NAME.c_str(), po::value<bool>()->default_value(Config::EMBED_DATA_DEFAULT_VALUE), "save train, test and aux data in every saved file; when false, data read from a file is saved as its path and content hash, checked on --restore-from")
+	(ASYNC_SAVE_NAME.c_str(), po::value<bool>()->default_value(Config::ASYNC_SAVE_DEFAULT_VALUE), "write samples and checkpoints on a background thread while sampling continues");
 
     po::options_description predict_desc("Used during prediction");
     predict_desc.add_options()
 	(PREDICT_NAME.c_str(), po::value<std::string>(), "sparse matrix with values to predict")
 	(ROW_FEAT_NAME.c_str(), po::value<std::string>(), "sparse/dense row features for out-of-matrix predictions")
 	(COL_FEAT_NAME.c_str(), po::value<std::string>(), "sparse/dense col features for out-of-matrix predictions")
-	(THRESHOLD_NAME.c_str(), po::value<double>()->default_value(Config::THRESHOLD_DEFAULT_VALUE), "threshold for binary classification and AUC calculation");
+	(THRESHOLD_NAME.c_str(), po::value<double>()->default_value(Config::THRESHOLD_DEFAULT_VALUE), "threshold for binary classification and AUC calculation")
+	(PREDICT_MODE_NAME.c_str(), po::value<std::string>()->default_value(predictModeToString(Config::PREDICT_MODE_DEFAULT_VALUE)), "<samples|summary>: average over all samples, or compute mean and variance in one pass from the posterior aggregates of the last checkpoint (approximate)");
 
     po::options_description save_desc("Storing models and predictions");
     save_desc.add_options()
 	(RESTORE_NAME.c_str(), po::value<std::string>(), "restore trainSession from a saved .h5 file")
 	(SAVE_NAME.c_str(), po::value<std::string>()->default_value(Config::SAVE_NAME_DEFAULT_VALUE), "save model and/or predictions to this .h5 file")
 	(SAVE_FREQ_NAME.c_str(), po::value<int>()->default_value(Config::SAVE_FREQ_DEFAULT_VALUE), "save every n iterations (0 == never, -1 == final model)")
-	(CHECKPOINT_FREQ_NAME.c_str(), po::value<int>()->default_value(Config::CHECKPOINT_FREQ_DEFAULT_VALUE), "save state every n seconds, only one checkpointing state is kept");
+	(CHECKPOINT_FREQ_NAME.c_str(), po::value<int>()->default_value(Config::CHECKPOINT_FREQ_DEFAULT_VALUE), "save state every n seconds, only one checkpointing state is kept")
+	(SAMPLE_STORAGE_NAME.c_str(), po::value<std::string>()->default_value(sampleStorageTypeToString(Config::SAMPLE_STORAGE_DEFAULT_VALUE)), "store the latent matrices of samples as <full|float16|uint8>; float16 and uint8 (per-column scale and offset) are lossy, checkpoints are always full")
+	(SAMPLE_COMPRESSION_NAME.c_str(), po::value<int>()->default_value(Config::SAMPLE_COMPRESSION_DEFAULT_VALUE), "deflate level (1-9) of the chunked latent matrices of samples and checkpoints (0 = not compressed)");
 
     po::options_description desc("SMURFF: Scalable Matrix Factorization Framework\n\thttp://github.com/ExaScience/smurff");
     desc.add(general_desc);
@@ -116,24 +139,24 @@ struct ConfigFiller
     }
 
     template <void (Config::*Func)(std::shared_ptr<DataConfig>)>
-    void set_data(std::string name)
+    void set_data(std::string name, bool isScarce = true)
     {
         if (vm.count(name) && !vm[name].defaulted())
         {
-            //auto tensor_config = generic_io::read_data_config(vm[name].as<std::string>(), true);
             auto tensor_config = std::make_shared<DataConfig>();
+            generic_io::read_data_config(vm[name].as<std::string>(), isScarce, *tensor_config, !config.getEmbedData());
             (this->config.*Func)(tensor_config);
         }
     }
+
+    // reads into the existing config, keeping its position and noise
+    // files that do not store their size (COO triplets) get nrow x ncol, when >= 0
+    // the content hash is only needed when the data is not embedded in saved files
     template <DataConfig& (Config::*Func)(void)>
-    void fill_data(std::string name)
+    void fill_data(std::string name, bool isScarce = true, std::int64_t nrow = -1, std::int64_t ncol = -1)
     {
         if (vm.count(name) && !vm[name].defaulted())
-        {
-            //auto tensor_config = generic_io::read_data_config(vm[name].as<std::string>(), true);
-            auto tensor_config = DataConfig();
-            (this->config.*Func)() = tensor_config;
-        }
+            generic_io::read_data_config(vm[name].as<std::string>(), isScarce, (this->config.*Func)(), !config.getEmbedData(), std::string(), nrow, ncol);
     }
 
     void set_priors(std::string name)
@@ -163,12 +186,21 @@ fill_config(const po::variables_map &vm)
             StateFile(restore_filename).restoreConfig(config);
     }
 
-    filler.fill_data<&Config::getPredict>(PREDICT_NAME);
-    filler.fill_data<&Config::getRowFeatures>(ROW_FEAT_NAME);
-    filler.fill_data<&Config::getColFeatures>(COL_FEAT_NAME);
-    filler.fill_data<&Config::getTest>(TEST_NAME);
+    // decides if data files are hashed
+    filler.set<bool,        &Config::setEmbedData>(EMBED_DATA_NAME);
+
     filler.fill_data<&Config::getTrain>(TRAIN_NAME);
 
+    // test and features have the rows and/or cols of train
+    const bool train_matrix = config.getTrain().hasData() && config.getTrain().getNModes() == 2;
+    const std::int64_t nrow = train_matrix ? (std::int64_t)config.getTrain().getNRow() : -1;
+    const std::int64_t ncol = train_matrix ? (std::int64_t)config.getTrain().getNCol() : -1;
+
+    filler.fill_data<&Config::getPredict>(PREDICT_NAME);
+    filler.fill_data<&Config::getRowFeatures>(ROW_FEAT_NAME, false, nrow);
+    filler.fill_data<&Config::getColFeatures>(COL_FEAT_NAME, false, ncol);
+    filler.fill_data<&Config::getTest>(TEST_NAME, true, nrow, ncol);
+
     filler.set_priors(PRIOR_NAME);
 
     filler.set<double,      &Config::setThreshold>(THRESHOLD_NAME);
@@ -180,9 +212,19 @@ fill_config(const po::variables_map &vm)
     filler.set<std::string, &Config::setSaveName>(SAVE_NAME);
     filler.set<int,         &Config::setSaveFreq>(SAVE_FREQ_NAME);
     filler.set<int,         &Config::setCheckpointFreq>(CHECKPOINT_FREQ_NAME);
+    filler.set<std::string, &Config::setSampleStorage>(SAMPLE_STORAGE_NAME);
+    filler.set<std::string, &Config::setPredictMode>(PREDICT_MODE_NAME);
+    filler.set<int,         &Config::setSampleCompression>(SAMPLE_COMPRESSION_NAME);
     filler.set<double,      &Config::setThreshold>(THRESHOLD_NAME);
     filler.set<int,         &Config::setVerbose>(VERBOSE_NAME);
     filler.set<int,         &Config::setRandomSeed>(SEED_NAME);
+    filler.set<bool,        &Config::setGatherKernel>(GATHER_KERNEL_NAME);
+    filler.set<bool,        &Config::setResidualCache>(RESIDUAL_CACHE_NAME);
+    filler.set<bool,        &Config::setDeferredStats>(DEFERRED_STATS_NAME);
+    filler.set<bool,        &Config::setDegreeSchedule>(DEGREE_SCHEDULE_NAME);
+    filler.set<bool,        &Config::setTransposedValues>(TRANSPOSED_VALUES_NAME);
+    filler.set<bool,        &Config::setMmapData>(MMAP_DATA_NAME);
+    filler.set<bool,        &Config::setAsyncSave>(ASYNC_SAVE_NAME);
 
     return config;
 }
@@ -239,7 +281,7 @@ Config parse_options(int argc, char *argv[])
     }
 
     const std::vector<std::string> train_only_options = {
-        TRAIN_NAME, TEST_NAME, PRIOR_NAME, BURNIN_NAME, NSAMPLES_NAME, NUM_LATENT_NAME};
+        TRAIN_NAME, TEST_NAME, PRIOR_NAME, BURNIN_NAME, NSAMPLES_NAME, NUM_LATENT_NAME, GATHER_KERNEL_NAME, RESIDUAL_CACHE_NAME, DEFERRED_STATS_NAME, DEGREE_SCHEDULE_NAME, TRANSPOSED_VALUES_NAME, MMAP_DATA_NAME, EMBED_DATA_NAME, ASYNC_SAVE_NAME, SAMPLE_STORAGE_NAME, SAMPLE_COMPRESSION_NAME};
 
     //-- prediction only
     if (vm.count(PREDICT_NAME) || vm.count(COL_FEAT_NAME) || vm.count(ROW_FEAT_NAME))
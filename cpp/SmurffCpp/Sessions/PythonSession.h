@@ -31,6 +31,15 @@ public:
    void setNumLatent(int value) { m_config.setNumLatent(value); } 
    void setThreshold(double value) { m_config.setThreshold(value); } 
    void setNumThreads(int value) { m_config.setNumThreads(value); }
+   void setGatherKernel(bool value) { m_config.setGatherKernel(value); }
+   void setResidualCache(bool value) { m_config.setResidualCache(value); }
+   void setDeferredStats(bool value) { m_config.setDeferredStats(value); }
+   void setDegreeSchedule(bool value) { m_config.setDegreeSchedule(value); }
+   void setTransposedValues(bool value) { m_config.setTransposedValues(value); }
+   void setMmapData(bool value) { m_config.setMmapData(value); }
+   void setAsyncSave(bool value) { m_config.setAsyncSave(value); }
+   void setSampleStorage(std::string value) { m_config.setSampleStorage(value); }
+   void setSampleCompression(int value) { m_config.setSampleCompression(value); }
 
    template <typename SparseType>
    void setTest(const SparseType &data)
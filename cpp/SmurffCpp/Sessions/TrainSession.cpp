@@ -37,6 +37,12 @@ void TrainSession::init()
         // close stateFile is we do not need it anymore
         if (!getConfig().getSaveFreq() && !getConfig().getCheckpointFreq())
             m_stateFile.reset();
+
+        // double buffered: sampling can run one step ahead of the write in progress
+        if (m_stateFile && getConfig().getAsyncSave())
+            m_writer.reset(new AsyncWriter<SaveSnapshot>(2, [this](const SaveSnapshot &s) {
+                writeStep(s.model, s.pred, s.iteration, s.checkpoint);
+            }));
     }
 
     // initialize pred
@@ -49,7 +55,7 @@ void TrainSession::init()
     }
 
     // init data
-    data_ptr = Data::create(getConfig().getData());
+    data_ptr = Data::create(getConfig());
    
     // initialize priors
     std::shared_ptr<IPriorFactory> priorFactory = this->create_prior_factory();
@@ -186,9 +192,6 @@ void TrainSession::save()
         //save this iteration
         saveInternal(icheckpoint, true);
 
-        //remove previous iteration if required (initial m_lastCheckpointIter is -1 which means that it does not exist)
-        m_stateFile->removeOldCheckpoints();
-
         //upddate counters
         m_lastCheckpointTime = tick();
         m_lastCheckpointIter = m_iter;
@@ -214,14 +217,38 @@ void TrainSession::save()
         }
     }
 
-    // close after final step
-    if (m_iter == niter - 1) m_stateFile.reset();
+    // close after final step, once all writes are done
+    if (m_iter == niter - 1)
+    {
+        if (m_writer)
+        {
+            m_writer->wait();
+            m_writer.reset();
+        }
+        m_stateFile.reset();
+    }
 }
 
 void TrainSession::saveInternal(int iteration, bool checkpoint)
+{
+    if (!m_writer)
+    {
+        writeStep(m_model, m_pred, iteration, checkpoint);
+        return;
+    }
+
+    // copy into a free buffer, reusing its memory; waits while both buffers are in use
+    SaveSnapshot &s = m_writer->acquire();
+    s.model = m_model;
+    s.pred = m_pred;
+    s.iteration = iteration;
+    s.checkpoint = checkpoint;
+    m_writer->push();
+}
+
+void TrainSession::writeStep(const Model &model, const Result &pred, int iteration, bool checkpoint)
 {
     bool final = iteration == getConfig().getNSamples();
-    SaveState saveState = m_stateFile->createStep(iteration, checkpoint, final || checkpoint);
 
     if (getConfig().getVerbose())
     {
@@ -229,9 +256,19 @@ void TrainSession::saveInternal(int iteration, bool checkpoint)
     }
     double start = tick();
 
-    m_model.save(saveState);
-    m_pred.save(saveState);
-    for (auto &p : m_priors) p->save(saveState);
+    {
+        // last_checkpoint is updated when saveState goes out of scope, after its data is on disk
+        SaveState saveState = m_stateFile->createStep(iteration, checkpoint, final || checkpoint);
+        saveState.setSampleStorage(getConfig().getSampleStorage(), getConfig().getSampleCompression());
+
+        model.save(saveState);
+        pred.save(saveState);
+        for (auto &p : m_priors) p->save(saveState);
+    }
+
+    //remove previous checkpoints, now that this one is referenced
+    if (checkpoint)
+        m_stateFile->removeOldCheckpoints();
 
     double stop = tick();
     if (getConfig().getVerbose())
@@ -383,6 +420,10 @@ void TrainSession::printStatus(std::ostream &output, bool resume)
         if (getConfig().getVerbose() > 2)
         {
             output << "  Compute Performance: " << status_item.samples_per_sec << " samples/sec, " << status_item.nnz_per_sec << " nnz/sec" << std::endl;
+            output << "  Load imbalance (max/mean thread time):";
+            for (const auto &p : m_priors)
+                output << " " << p->getLoadImbalance();
+            output << std::endl;
         }
     }
 }
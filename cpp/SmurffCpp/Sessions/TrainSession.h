@@ -7,6 +7,7 @@
 #include <SmurffCpp/Configs/Config.h>
 #include <SmurffCpp/Priors/IPriorFactory.h>
 #include <SmurffCpp/Utils/StateFile.h>
+#include <SmurffCpp/Utils/AsyncWriter.hpp>
 #include <SmurffCpp/StatusItem.h>
 #include <SmurffCpp/Sessions/ISession.h>
 #include <SmurffCpp/Model.h>
@@ -35,6 +36,18 @@ protected:
 private:
    std::shared_ptr<StateFile> m_stateFile;
 
+   // copy of the state to save, written by m_writer while sampling continues
+   struct SaveSnapshot
+   {
+      Model model;
+      Result pred;
+      int iteration;
+      bool checkpoint;
+   };
+
+   // with async_save: declared after everything the writes use, so it is destroyed (and drained) first
+   std::unique_ptr<AsyncWriter<SaveSnapshot>> m_writer;
+
 private:
    int m_iter = -1; //index of step iteration
    double m_secs_per_iter = .0; //time in seconds for last_iter
@@ -65,6 +78,9 @@ private:
 
    void saveInternal(int iteration, bool checkpoint);
 
+   //write one step to the state file, on the writer thread with async_save
+   void writeStep(const Model &model, const Result &pred, int iteration, bool checkpoint);
+
    //restore last iteration
    bool restore(int& iteration);
 
@@ -1,9 +1,14 @@
 #pragma once
 
 #include <complex.h>
+#include <SmurffCpp/Utils/NoMalloc.h>
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
 
+#ifndef SMURFF_AGGR_FLOAT_TYPE
+#define SMURFF_AGGR_FLOAT_TYPE SMURFF_FLOAT_TYPE
+#endif
+
 namespace smurff {
    typedef SMURFF_FLOAT_TYPE float_type;
 
@@ -16,6 +21,11 @@ namespace smurff {
    typedef Eigen::Array<float_type, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> Array2D;
    typedef Eigen::Array<float_type, 1, Eigen::Dynamic, Eigen::RowMajor> Array1D;
    typedef Eigen::SparseMatrix<float_type, Eigen::RowMajor> SparseMatrix;
+   typedef Eigen::Map<const SparseMatrix> SparseMatrixMap; // compressed arrays owned elsewhere
+
+   // posterior aggregates can be kept in a smaller type than float_type
+   typedef SMURFF_AGGR_FLOAT_TYPE aggr_type;
+   typedef Eigen::Matrix<aggr_type, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> AggrMatrix;
 };
 
 #include <SmurffCpp/Utils/Tensor.h>
\ No newline at end of file
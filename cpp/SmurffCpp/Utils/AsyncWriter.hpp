@@ -0,0 +1,149 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <SmurffCpp/Utils/Error.h>
+
+namespace smurff {
+
+// Writes snapshots on a background thread, in the order they are pushed.
+//
+// The writer owns a fixed set of buffers: the caller fills a free one (acquire),
+// queues it (push), and it is reused once written. While all buffers are queued
+// or being written, acquire waits, so the caller runs ahead of the writes by at
+// most that many snapshots.
+//
+// An exception thrown by write is rethrown by every later acquire, push and wait.
+// Snapshots queued after a failed write are dropped.
+template <typename Snapshot>
+class AsyncWriter
+{
+private:
+   std::function<void(const Snapshot &)> m_write;
+
+   std::vector<Snapshot> m_buffers;
+   std::deque<std::size_t> m_free;
+   std::deque<std::size_t> m_queue;
+   std::size_t m_acquired; // buffer being filled, m_buffers.size() if none
+   bool m_writing;
+   bool m_stop;
+   std::exception_ptr m_error;
+
+   std::mutex m_mutex;
+   std::condition_variable m_cond;
+   std::thread m_thread;
+
+public:
+   AsyncWriter(std::size_t nbuffers, std::function<void(const Snapshot &)> write)
+      : m_write(write), m_buffers(nbuffers), m_acquired(nbuffers), m_writing(false), m_stop(false)
+   {
+      THROWERROR_ASSERT(nbuffers > 0);
+      for (std::size_t i = 0; i < nbuffers; ++i)
+         m_free.push_back(i);
+
+      m_thread = std::thread(&AsyncWriter::run, this);
+   }
+
+   // writes all queued snapshots before returning
+   ~AsyncWriter()
+   {
+      {
+         std::lock_guard<std::mutex> lock(m_mutex);
+         m_stop = true;
+      }
+      m_cond.notify_all();
+      m_thread.join();
+   }
+
+   AsyncWriter(const AsyncWriter &) = delete;
+   AsyncWriter &operator=(const AsyncWriter &) = delete;
+
+public:
+   // a free buffer to fill, waits while none is free
+   Snapshot &acquire()
+   {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      THROWERROR_ASSERT_MSG(m_acquired == m_buffers.size(), "AsyncWriter: previous buffer not pushed");
+
+      m_cond.wait(lock, [this] { return !m_free.empty() || m_error; });
+      rethrow();
+
+      m_acquired = m_free.front();
+      m_free.pop_front();
+      return m_buffers[m_acquired];
+   }
+
+   // queues the buffer returned by acquire
+   void push()
+   {
+      {
+         std::lock_guard<std::mutex> lock(m_mutex);
+         THROWERROR_ASSERT_MSG(m_acquired < m_buffers.size(), "AsyncWriter: no buffer acquired");
+         rethrow();
+
+         m_queue.push_back(m_acquired);
+         m_acquired = m_buffers.size();
+      }
+      m_cond.notify_all();
+   }
+
+   // waits until all queued snapshots are written
+   void wait()
+   {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_cond.wait(lock, [this] { return (m_queue.empty() && !m_writing) || m_error; });
+      rethrow();
+   }
+
+private:
+   void rethrow() const
+   {
+      if (m_error)
+         std::rethrow_exception(m_error);
+   }
+
+   void run()
+   {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      while (true)
+      {
+         m_cond.wait(lock, [this] { return !m_queue.empty() || m_stop; });
+         if (m_queue.empty())
+            return;
+
+         const std::size_t i = m_queue.front();
+         m_queue.pop_front();
+
+         if (!m_error)
+         {
+            m_writing = true;
+            lock.unlock();
+
+            std::exception_ptr error;
+            try
+            {
+               m_write(m_buffers[i]);
+            }
+            catch (...)
+            {
+               error = std::current_exception();
+            }
+
+            lock.lock();
+            m_writing = false;
+            m_error = error;
+         }
+
+         m_free.push_back(i);
+         m_cond.notify_all();
+      }
+   }
+};
+
+}
@@ -6,6 +6,7 @@
 #include <iostream>
 #include <complex.h>
 
+#include <SmurffCpp/Utils/NoMalloc.h>
 #include <Eigen/Core>
 
 template<typename Matrix>
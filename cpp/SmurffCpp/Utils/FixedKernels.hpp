@@ -0,0 +1,111 @@
+#pragma once
+
+#include <type_traits>
+
+#include <SmurffCpp/Types.h>
+#include <SmurffCpp/Utils/Distribution.h>
+#include <SmurffCpp/Utils/Error.h>
+
+namespace smurff {
+namespace kernels {
+
+// The K x K kernels below are instantiated with fixed-size Eigen types for
+// the common values of num_latent, so Eigen can unroll and register-block them.
+// Other values of num_latent use K = Eigen::Dynamic, i.e. the plain dynamic path.
+//
+// Fixed-size versions work on Maps/blocks over the existing dynamic storage,
+// nothing is copied to the stack.
+
+template <int K>
+using MatrixK = Eigen::Matrix<float_type, K, K, Eigen::RowMajor>;
+
+template <int K>
+using VectorK = Eigen::Matrix<float_type, 1, K, Eigen::RowMajor>;
+
+// calls f(std::integral_constant<int, K>()), with K = num_latent for the
+// specialized sizes and K = Eigen::Dynamic otherwise
+template <typename F>
+inline auto dispatch(int num_latent, F &&f) -> decltype(f(std::integral_constant<int, Eigen::Dynamic>()))
+{
+   switch (num_latent)
+   {
+      case 8:   return f(std::integral_constant<int, 8>());
+      case 16:  return f(std::integral_constant<int, 16>());
+      case 32:  return f(std::integral_constant<int, 32>());
+      case 64:  return f(std::integral_constant<int, 64>());
+      case 128: return f(std::integral_constant<int, 128>());
+      default:  return f(std::integral_constant<int, Eigen::Dynamic>());
+   }
+}
+
+// Sample x from N(MM^-1 * rr, MM^-1) and store it in rr.
+// MM is overwritten with its Cholesky factor.
+template <int K>
+inline void sample_mvnormal(Matrix &MM, Vector &rr)
+{
+   const int nl = rr.size();
+   Eigen::Map<MatrixK<K>> M(MM.data(), nl, nl);
+   Eigen::Map<VectorK<K>> x(rr.data(), nl);
+
+   Eigen::LLT<Eigen::Ref<MatrixK<K>>> chol(M); // in place: X = L * U
+   if(chol.info() != Eigen::Success)
+   {
+      THROWERROR("Cholesky Decomposition failed!");
+   }
+
+   chol.matrixL().solveInPlace(x.transpose()); // solve for y: y = L^-1 * b
+   x.noalias() += VectorK<K>::NullaryExpr(1, nl, RandNormalGenerator());
+   chol.matrixU().solveInPlace(x.transpose()); // solve for x: x = U^-1 * y
+}
+
+inline void sample_mvnormal(Matrix &MM, Vector &rr)
+{
+   dispatch(rr.size(), [&MM, &rr](auto k) { sample_mvnormal<decltype(k)::value>(MM, rr); });
+}
+
+// sum_k a(k) * b(k)
+template <int K, typename A, typename B>
+inline double dot(const A &a, const B &b)
+{
+   const int nl = a.size();
+   return a.template head<K>(nl).dot(b.template head<K>(nl));
+}
+
+template <typename A, typename B>
+inline double dot(const A &a, const B &b)
+{
+   return dispatch(a.size(), [&a, &b](auto k) { return dot<decltype(k)::value>(a, b); });
+}
+
+// rows of V gathered per tile by gather_dot
+constexpr int GATHER_DOT_TILE = 8;
+
+// out[j] = h . V.row(index(j)), j < n
+// The rows of V are copied into a GATHER_DOT_TILE x K tile, so each tile is one
+// fixed-size matrix-vector product with independent sums per row.
+template <int K, typename H, typename Index>
+inline void gather_dot(const H &h, const Matrix &V, const Index &index, std::size_t n, double *out)
+{
+   const int nl = h.size();
+   const auto hK = h.template head<K>(nl);
+
+   Eigen::Matrix<float_type, GATHER_DOT_TILE, K, Eigen::RowMajor> tile(GATHER_DOT_TILE, nl);
+   Eigen::Matrix<float_type, GATHER_DOT_TILE, 1> p;
+
+   std::size_t j = 0;
+   for (; j + GATHER_DOT_TILE <= n; j += GATHER_DOT_TILE)
+   {
+      for (int t = 0; t < GATHER_DOT_TILE; ++t)
+         tile.row(t) = V.row(index(j + t)).template head<K>(nl);
+
+      p.noalias() = tile * hK.transpose();
+      for (int t = 0; t < GATHER_DOT_TILE; ++t)
+         out[j + t] = p(t);
+   }
+
+   for (; j < n; ++j)
+      out[j] = hK.dot(V.row(index(j)).template head<K>(nl));
+}
+
+} // end namespace kernels
+} // end namespace smurff
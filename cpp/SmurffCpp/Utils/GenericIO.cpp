@@ -0,0 +1,78 @@
+#include "GenericIO.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include <SmurffCpp/Utils/MappedFile.h>
+#include <SmurffCpp/Utils/MatrixIO.h>
+#include <SmurffCpp/Utils/Error.h>
+
+namespace smurff { namespace generic_io {
+
+static const std::uint64_t HASH_BLOCK_SIZE = 1 << 20;
+
+static std::uint64_t fnv1a(const unsigned char *data, std::uint64_t size, std::uint64_t h = 0xcbf29ce484222325ULL)
+{
+   for (std::uint64_t i = 0; i < size; ++i)
+   {
+      h ^= data[i];
+      h *= 0x100000001b3ULL;
+   }
+   return h;
+}
+
+bool file_exists(const std::string& filename)
+{
+   return std::ifstream(filename.c_str()).good();
+}
+
+std::string file_hash(const std::string& filename)
+{
+   return file_hash(MappedFile(filename));
+}
+
+std::string file_hash(const MappedFile& file)
+{
+   const unsigned char *data = file.size() ? file.data<unsigned char>(0, file.size()) : nullptr;
+
+   const std::uint64_t nblocks = (file.size() + HASH_BLOCK_SIZE - 1) / HASH_BLOCK_SIZE;
+   std::vector<std::uint64_t> blocks(nblocks);
+
+   #pragma omp parallel for schedule(dynamic, 1)
+   for (std::uint64_t b = 0; b < nblocks; ++b)
+   {
+      const std::uint64_t begin = b * HASH_BLOCK_SIZE;
+      blocks[b] = fnv1a(data + begin, std::min(HASH_BLOCK_SIZE, file.size() - begin));
+   }
+
+   const std::uint64_t size = file.size();
+   std::uint64_t h = fnv1a(reinterpret_cast<const unsigned char *>(&size), sizeof(size));
+   h = fnv1a(reinterpret_cast<const unsigned char *>(blocks.data()), blocks.size() * sizeof(std::uint64_t), h);
+
+   char hex[17];
+   std::snprintf(hex, sizeof(hex), "%016llx", (unsigned long long)h);
+   return hex;
+}
+
+void read_data_config(const std::string& filename, bool isScarce, DataConfig& dataConfig, bool hash,
+                      const std::string& expected_hash, std::int64_t nrow_hint, std::int64_t ncol_hint)
+{
+   THROWERROR_FILE_NOT_EXIST(filename);
+
+   MappedFile file(filename);
+
+   std::string content_hash;
+   if (hash || !expected_hash.empty())
+      content_hash = file_hash(file);
+
+   THROWERROR_ASSERT_MSG(expected_hash.empty() || content_hash == expected_hash,
+      "Content of '" + filename + "' changed since it was referenced: hash " + content_hash + ", expected " + expected_hash);
+
+   matrix_io::read_matrix(file, isScarce, dataConfig, nrow_hint, ncol_hint);
+   dataConfig.setFilename(filename);
+   dataConfig.setFileHash(content_hash);
+}
+
+}}
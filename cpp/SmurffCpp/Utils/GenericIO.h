@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <SmurffCpp/Configs/DataConfig.h>
+
+namespace smurff {
+
+class MappedFile;
+
+namespace generic_io {
+
+bool file_exists(const std::string& filename);
+
+// content hash of a file: 64-bit FNV-1a of the FNV-1a hashes of its 1 MiB blocks, in hex
+// blocks are hashed in parallel
+std::string file_hash(const std::string& filename);
+std::string file_hash(const MappedFile& file);
+
+// reads the matrix in filename (see matrix_io::read_matrix) into dataConfig,
+// keeping its position and noise configuration
+// with hash, or when expected_hash is given, also records the content hash of the file;
+// the hash and the matrix are read from the same mapping of the file
+// when expected_hash is given, a file with different content is an error
+// nrow_hint and ncol_hint give the size of files that do not store it (COO triplets), when >= 0
+void read_data_config(const std::string& filename, bool isScarce, DataConfig& dataConfig, bool hash = true,
+                      const std::string& expected_hash = std::string(), std::int64_t nrow_hint = -1, std::int64_t ncol_hint = -1);
+
+}}
@@ -1,13 +1,24 @@
+#include <algorithm>
 #include <iostream>
 
 #include <SmurffCpp/Utils/HDF5Group.h>
 
 #include <SmurffCpp/Utils/Error.h>
 #include <SmurffCpp/Utils/StringUtils.h>
+#include <SmurffCpp/Utils/MatrixUtils.h>
+#include <SmurffCpp/Utils/SampleCodec.h>
 
 
 namespace smurff {
 
+// attributes of encoded dense datasets, see write(..., SampleStorageTypes, int)
+static const std::string ENCODING_ATTR = "encoding";
+static const std::string ENCODING_FLOAT16 = "float16";
+static const std::string ENCODING_UINT8 = "uint8";
+static const std::string MAX_ERROR_ATTR = "max_abs_error";
+static const std::string SCALE_ATTR = "scale";
+static const std::string OFFSET_ATTR = "offset";
+
 bool HDF5Group::hasDataSet(const std::string& section, const std::string& tag) const
 {
    if (!m_group.exist(section)) return false;
@@ -20,6 +31,15 @@ bool HDF5Group::hasSection(const std::string& section) const
    return m_group.exist(section);
 }
 
+std::string HDF5Group::getFileName() const
+{
+   ssize_t size = H5Fget_name(m_group.getId(), nullptr, 0);
+   THROWERROR_ASSERT(size >= 0);
+   std::vector<char> name(size + 1);
+   H5Fget_name(m_group.getId(), name.data(), name.size());
+   return std::string(name.data());
+}
+
 h5::Group HDF5Group::addGroup(const std::string& name)
 {
    if (!m_group.exist(name)) m_group.createGroup(name);
@@ -31,25 +51,91 @@ h5::Group HDF5Group::getGroup(const std::string& name) const
    return m_group.getGroup(name);
 }
 
-void HDF5Group::read(const std::string& section, const std::string& tag, Matrix &X) const
+// reads the given rows of dataset, or all rows when rows is null; the runs of consecutive
+// rows form one selection, read in a single call so each chunk is decompressed once
+template <typename T>
+static void read_values(const h5::DataSet &dataset, const std::vector<int> *rows, std::size_t cols, T *data)
+{
+   if (!rows)
+   {
+      dataset.read(data);
+      return;
+   }
+
+   if (cols == 0 || rows->empty())
+      return;
+
+   h5::HyperSlab slab;
+   for (std::size_t i = 0; i < rows->size();)
+   {
+      std::size_t n = 1;
+      while (i + n < rows->size() && (*rows)[i + n] == (*rows)[i] + static_cast<int>(n))
+         ++n;
+
+      slab |= h5::RegularHyperSlab({static_cast<std::size_t>((*rows)[i]), 0}, {n, cols});
+      i += n;
+   }
+
+   // HDF5 returns the selected rows in file order, which is the order of rows
+   dataset.select(slab).read(data);
+}
+
+template <typename Scalar>
+static void read_dense(const h5::DataSet &dataset, const std::vector<int> *rows, Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> &X)
 {
-   auto dataset = m_group.getGroup(section).getDataSet(tag);
    std::vector<size_t> dims = dataset.getDimensions();
-   X.resize(dims[0], dims[1]);
-   dataset.read(X.data());
+   X.resize(rows ? rows->size() : dims[0], dims[1]);
 
-   if (!X.IsRowMajor)
+   if (!dataset.hasAttribute(ENCODING_ATTR))
    {
-      Matrix colMajor = Eigen::Map<Eigen::Matrix<
-            typename Matrix::Scalar,
-            Matrix::RowsAtCompileTime,
-            Matrix::ColsAtCompileTime,
-            Matrix::ColsAtCompileTime==1?Eigen::ColMajor:Eigen::RowMajor,
-            Matrix::MaxRowsAtCompileTime,
-            Matrix::MaxColsAtCompileTime>>(X.data(), dims[0], dims[1]);
-
-      std::swap(colMajor, X);
+      // HDF5 converts when the stored type differs from Scalar
+      read_values(dataset, rows, dims[1], X.data());
+      return;
    }
+
+   std::string encoding;
+   dataset.getAttribute(ENCODING_ATTR).read(encoding);
+   if (encoding == ENCODING_FLOAT16)
+   {
+      std::vector<std::uint16_t> data(X.size());
+      read_values(dataset, rows, dims[1], data.data());
+      sample_codec::decode_float16(data, X);
+   }
+   else if (encoding == ENCODING_UINT8)
+   {
+      std::vector<std::uint8_t> data(X.size());
+      read_values(dataset, rows, dims[1], data.data());
+      std::vector<double> scale, offset;
+      dataset.getAttribute(SCALE_ATTR).read(scale);
+      dataset.getAttribute(OFFSET_ATTR).read(offset);
+      sample_codec::decode_uint8(data, scale, offset, X);
+   }
+   else
+   {
+      THROWERROR("Unknown encoding '" + encoding + "' of dataset " + dataset.getPath());
+   }
+}
+
+template <typename Scalar>
+void HDF5Group::read(const std::string& section, const std::string& tag, Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> &X) const
+{
+   read_dense(m_group.getGroup(section).getDataSet(tag), nullptr, X);
+}
+
+template void HDF5Group::read(const std::string&, const std::string&, Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> &) const;
+template void HDF5Group::read(const std::string&, const std::string&, Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> &) const;
+template void HDF5Group::read(const std::string&, const std::string&, Eigen::Matrix<int, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> &) const;
+
+std::size_t HDF5Group::read(const std::string& section, const std::string& tag, const std::vector<int> &rows, Matrix &X) const
+{
+   auto dataset = m_group.getGroup(section).getDataSet(tag);
+   const std::size_t nrows = dataset.getDimensions().at(0);
+
+   THROWERROR_ASSERT(std::is_sorted(rows.begin(), rows.end()) && std::adjacent_find(rows.begin(), rows.end()) == rows.end());
+   THROWERROR_ASSERT(rows.empty() || (rows.front() >= 0 && static_cast<std::size_t>(rows.back()) < nrows));
+
+   read_dense(dataset, rows.size() < nrows ? &rows : nullptr, X);
+   return nrows;
 }
 
 void HDF5Group::read(const std::string& section, const std::string& tag, Vector &X) const
@@ -81,14 +167,73 @@ void HDF5Group::read(const std::string& section, const std::string& tag, SparseM
    data.read(X.valuePtr());
 
    auto indptr = sparse_group.getDataSet("indptr");
-   THROWERROR_ASSERT(indptr.getDataType() == h5::AtomicType<SparseMatrix::Index>());
+   THROWERROR_ASSERT(indptr.getDataType() == h5::AtomicType<SparseMatrix::Index>() || indptr.getDataType() == h5::AtomicType<SparseMatrix::StorageIndex>());
    indptr.read(X.outerIndexPtr());
 
    auto indices = sparse_group.getDataSet("indices");
-   THROWERROR_ASSERT(indices.getDataType() == h5::AtomicType<SparseMatrix::Index>());
+   THROWERROR_ASSERT(indices.getDataType() == h5::AtomicType<SparseMatrix::Index>() || indices.getDataType() == h5::AtomicType<SparseMatrix::StorageIndex>());
    indices.read(X.innerIndexPtr());
 }
 
+bool HDF5Group::map(const std::string& section, const std::string& tag, MappedSparseMatrix &X) const
+{
+   typedef SparseMatrix::StorageIndex Index;
+
+   if (!hasDataSet(section, tag))
+      return false;
+
+   auto sparse_group = m_group.getGroup(section).getGroup(tag);
+   if (!sparse_group.exist("t_perm"))
+      return false;
+
+   std::string format;
+   sparse_group.getAttribute("h5sparse_format").read(format);
+   THROWERROR_ASSERT(SparseMatrix::IsRowMajor && format == "csr");
+
+   std::vector<Eigen::Index> shape(2);
+   sparse_group.getAttribute("h5sparse_shape").read(shape);
+   const std::size_t nnz = sparse_group.getDataSet("data").getElementCount();
+
+   // file offset of a dataset stored contiguously with the in-memory type
+   auto offset = [&sparse_group](const std::string &name, const h5::DataType &type, std::size_t count, std::uint64_t &value) -> bool
+   {
+      auto dataset = sparse_group.getDataSet(name);
+      if (!(dataset.getDataType() == type) || dataset.getElementCount() != count)
+         return false;
+
+      haddr_t addr = H5Dget_offset(dataset.getId());
+      if (addr == HADDR_UNDEF || addr % type.getSize())
+         return false;
+
+      value = addr;
+      return true;
+   };
+
+   std::uint64_t data, indptr, indices, t_indptr, t_indices, t_perm;
+   if (!offset("data",      h5::AtomicType<float_type>(), nnz,          data)      ||
+       !offset("indptr",    h5::AtomicType<Index>(),      shape[0] + 1, indptr)    ||
+       !offset("indices",   h5::AtomicType<Index>(),      nnz,          indices)   ||
+       !offset("t_indptr",  h5::AtomicType<Index>(),      shape[1] + 1, t_indptr)  ||
+       !offset("t_indices", h5::AtomicType<Index>(),      nnz,          t_indices) ||
+       !offset("t_perm",    h5::AtomicType<Index>(),      nnz,          t_perm))
+      return false;
+
+   auto file = std::make_shared<MappedFile>(getFileName());
+
+   X.file = file;
+   X.rows = shape[0];
+   X.cols = shape[1];
+   X.nnz = nnz;
+   X.values = file->data<float_type>(data, nnz);
+   X.outer = file->data<Index>(indptr, shape[0] + 1);
+   X.inner = file->data<Index>(indices, nnz);
+   X.t_outer = file->data<Index>(t_indptr, shape[1] + 1);
+   X.t_inner = file->data<Index>(t_indices, nnz);
+   X.t_perm = file->data<Index>(t_perm, nnz);
+
+   return true;
+}
+
 void HDF5Group::read(const std::string& section, const std::string& tag, DenseTensor &) const
 {
    THROWERROR_NOTIMPL();
@@ -104,30 +249,85 @@ void HDF5Group::write(const std::string& section, const std::string& tag, const
    write(section, tag, Matrix(V));
 }
 
-void HDF5Group::write(const std::string& section, const std::string& tag, const Matrix &M)
+template <typename Scalar>
+void HDF5Group::write(const std::string& section, const std::string& tag, const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> &M)
+{
+   if (!m_group.exist(section))
+      m_group.createGroup(section);
+
+   h5::Group group = m_group.getGroup(section);
+   h5::DataSet dataset = group.createDataSet<Scalar>(tag, h5::DataSpace({static_cast<size_t>(M.rows()),  static_cast<size_t>(M.cols())}));
+   dataset.write_raw(M.data());
+}
+
+template void HDF5Group::write(const std::string&, const std::string&, const Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> &);
+template void HDF5Group::write(const std::string&, const std::string&, const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> &);
+template void HDF5Group::write(const std::string&, const std::string&, const Eigen::Matrix<int, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> &);
+
+// chunks of about 1 MiB, of whole rows, with the shuffle and deflate filters
+static h5::DataSetCreateProps compressedProps(std::size_t rows, std::size_t cols, std::size_t elem_size, int level)
+{
+   h5::DataSetCreateProps props;
+   if (level <= 0 || rows == 0 || cols == 0)
+      return props;
+
+   const std::size_t chunk_rows = std::min(rows, std::max<std::size_t>(1, (1 << 20) / (cols * elem_size)));
+   props.add(h5::Chunking(std::vector<hsize_t>{chunk_rows, cols}));
+   props.add(h5::Shuffle());
+   props.add(h5::Deflate(std::min(level, 9)));
+   return props;
+}
+
+void HDF5Group::write(const std::string& section, const std::string& tag, const Matrix &M, SampleStorageTypes storage, int compression)
 {
    if (!m_group.exist(section))
       m_group.createGroup(section);
 
    h5::Group group = m_group.getGroup(section);
-   h5::DataSet dataset = group.createDataSet<Matrix::Scalar>(tag, h5::DataSpace({static_cast<size_t>(M.rows()),  static_cast<size_t>(M.cols())}));
+   const std::size_t rows = M.rows(), cols = M.cols();
+   h5::DataSpace space({rows, cols});
+
+   double max_error;
+   std::vector<std::uint16_t> half;
+   if (storage == SampleStorageTypes::float16 && sample_codec::encode_float16(M, half, max_error))
+   {
+      h5::DataSet dataset = group.createDataSet<std::uint16_t>(tag, space, compressedProps(rows, cols, sizeof(std::uint16_t), compression));
+      dataset.write_raw(half.data());
+      dataset.createAttribute<std::string>(ENCODING_ATTR, ENCODING_FLOAT16);
+      dataset.createAttribute<double>(MAX_ERROR_ATTR, max_error);
+      return;
+   }
+
+   if (storage == SampleStorageTypes::uint8)
+   {
+      std::vector<std::uint8_t> data;
+      std::vector<double> scale, offset;
+      sample_codec::encode_uint8(M, data, scale, offset, max_error);
+
+      h5::DataSet dataset = group.createDataSet<std::uint8_t>(tag, space, compressedProps(rows, cols, sizeof(std::uint8_t), compression));
+      dataset.write_raw(data.data());
+      dataset.createAttribute<std::string>(ENCODING_ATTR, ENCODING_UINT8);
+      dataset.createAttribute<double>(MAX_ERROR_ATTR, max_error);
+      dataset.createAttribute<double>(SCALE_ATTR, h5::DataSpace::From(scale)).write(scale);
+      dataset.createAttribute<double>(OFFSET_ATTR, h5::DataSpace::From(offset)).write(offset);
+      return;
+   }
 
-   Eigen::Ref<
-        const Eigen::Matrix<
-            Matrix::Scalar,
-            Matrix::RowsAtCompileTime,
-            Matrix::ColsAtCompileTime,
-            Matrix::ColsAtCompileTime==1?Eigen::ColMajor:Eigen::RowMajor,
-            Matrix::MaxRowsAtCompileTime,
-            Matrix::MaxColsAtCompileTime>,
-        0,
-        Eigen::InnerStride<1>> row_major(M);
+   // full precision, also when float16 cannot represent M
+   h5::DataSet dataset = group.createDataSet<float_type>(tag, space, compressedProps(rows, cols, sizeof(float_type), compression));
+   dataset.write_raw(M.data());
+}
 
-    dataset.write_raw(row_major.data());
+void HDF5Group::write(const std::string& section, const std::string& tag, const SparseMatrix &X, bool transposed_index)
+{
+   THROWERROR_ASSERT(X.isCompressed());
+   write(section, tag, SparseMatrixMap(X.rows(), X.cols(), X.nonZeros(), X.outerIndexPtr(), X.innerIndexPtr(), X.valuePtr()), transposed_index);
 }
 
-void HDF5Group::write(const std::string& section, const std::string& tag, const SparseMatrix &X)
+void HDF5Group::write(const std::string& section, const std::string& tag, const SparseMatrixMap &X, bool transposed_index)
 {
+   typedef SparseMatrix::StorageIndex Index;
+
    if (!m_group.exist(section))
       m_group.createGroup(section);
 
@@ -140,11 +340,29 @@ void HDF5Group::write(const std::string& section, const std::string& tag, const
    auto data = sparse_group.createDataSet<SparseMatrix::value_type>("data", h5::DataSpace(X.nonZeros()));
    data.write(X.valuePtr());
 
-   auto indptr = sparse_group.createDataSet<SparseMatrix::Index>("indptr", h5::DataSpace(X.outerSize() + 1));
+   if (!transposed_index)
+   {
+      auto indptr = sparse_group.createDataSet<SparseMatrix::Index>("indptr", h5::DataSpace(X.outerSize() + 1));
+      indptr.write(X.outerIndexPtr());
+
+      auto indices = sparse_group.createDataSet<SparseMatrix::Index>("indices", h5::DataSpace(X.nonZeros()));
+      indices.write(X.innerIndexPtr());
+      return;
+   }
+
+   // stored with the in-memory index type, so that map() can use them as they are
+   auto indptr = sparse_group.createDataSet<Index>("indptr", h5::DataSpace(X.outerSize() + 1));
    indptr.write(X.outerIndexPtr());
 
-   auto indices = sparse_group.createDataSet<SparseMatrix::Index>("indices", h5::DataSpace(X.nonZeros()));
+   auto indices = sparse_group.createDataSet<Index>("indices", h5::DataSpace(X.nonZeros()));
    indices.write(X.innerIndexPtr());
+
+   std::vector<Index> t_outer, t_inner, t_perm;
+   matrix_utils::transposed_index(X, t_outer, t_inner, t_perm);
+
+   sparse_group.createDataSet<Index>("t_indptr", h5::DataSpace(t_outer.size())).write(t_outer.data());
+   sparse_group.createDataSet<Index>("t_indices", h5::DataSpace(t_inner.size())).write(t_inner.data());
+   sparse_group.createDataSet<Index>("t_perm", h5::DataSpace(t_perm.size())).write(t_perm.data());
 }
 
 void HDF5Group::write(const std::string& section, const std::string& tag, const DenseTensor &X)
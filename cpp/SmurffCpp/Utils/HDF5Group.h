@@ -9,7 +9,9 @@
 #include <highfive/H5File.hpp>
 
 #include <SmurffCpp/Types.h>
+#include <SmurffCpp/Configs/Config.h>
 #include <SmurffCpp/Utils/HDF5Group.h>
+#include <SmurffCpp/Utils/MappedFile.h>
 
 namespace h5 = HighFive;
 
@@ -48,6 +50,7 @@ namespace smurff {
 
       bool hasDataSet(const std::string &section, const std::string& tag) const;
       bool hasSection(const std::string &section) const;
+      std::string getFileName() const;
 
       int         get(const std::string &section, const std::string& tag, const int         &default_value) const
       { return getInternal(section, tag, default_value); }
@@ -68,11 +71,18 @@ namespace smurff {
       { return getInternal(section, tag, default_value); }
 
       void read(const std::string &section, const std::string& tag, Vector &) const;
-      void read(const std::string &section, const std::string& tag, Matrix &) const;
+      template <typename Scalar>
+      void read(const std::string &section, const std::string& tag, Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> &) const;
+      // reads the given rows (sorted, unique) of a dense matrix, in that order; returns the number of rows stored
+      std::size_t read(const std::string &section, const std::string& tag, const std::vector<int> &rows, Matrix &) const;
       void read(const std::string &section, const std::string& tag, SparseMatrix &) const;
       void read(const std::string &section, const std::string& tag, DenseTensor &) const;
       void read(const std::string &section, const std::string& tag, SparseTensor &) const;
 
+      // maps a sparse matrix written with its transposed index, without reading it
+      // returns false if it was written without, or is not stored contiguously
+      bool map(const std::string &section, const std::string& tag, MappedSparseMatrix &) const;
+
       void put(const std::string &section, const std::string& tag, const int         &value)
       { putInternal(section, tag, value); }
 
@@ -92,8 +102,13 @@ namespace smurff {
       { putInternal(section, tag, value); }
 
       void write(const std::string &section, const std::string& tag, const Vector &);
-      void write(const std::string &section, const std::string& tag, const Matrix &);
-      void write(const std::string &section, const std::string& tag, const SparseMatrix &);
+      template <typename Scalar>
+      void write(const std::string &section, const std::string& tag, const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> &);
+      // chunked and deflate-compressed when compression (1-9) > 0; float16 and uint8 are lossy,
+      // see SampleCodec.h, and recorded in attributes of the dataset so read decodes them
+      void write(const std::string &section, const std::string& tag, const Matrix &, SampleStorageTypes storage, int compression);
+      void write(const std::string &section, const std::string& tag, const SparseMatrix &, bool transposed_index = false);
+      void write(const std::string &section, const std::string& tag, const SparseMatrixMap &, bool transposed_index = false);
       void write(const std::string &section, const std::string& tag, const DenseTensor &);
       void write(const std::string &section, const std::string& tag, const SparseTensor &);
    };
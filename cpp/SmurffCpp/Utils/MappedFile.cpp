@@ -0,0 +1,71 @@
+#include "MappedFile.h"
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <SmurffCpp/Utils/Error.h>
+
+namespace smurff {
+
+#ifndef _WIN32
+
+MappedFile::MappedFile(const std::string &path)
+   : m_path(path), m_addr(nullptr), m_size(0)
+{
+   int fd = ::open(path.c_str(), O_RDONLY);
+   THROWERROR_ASSERT_MSG(fd >= 0, "Could not open '" + path + "' for mapping");
+
+   struct stat st;
+   if (::fstat(fd, &st) != 0)
+   {
+      ::close(fd);
+      THROWERROR("Could not stat '" + path + "'");
+   }
+   m_size = st.st_size;
+
+   if (m_size)
+   {
+      m_addr = ::mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+      if (m_addr == MAP_FAILED)
+      {
+         m_addr = nullptr;
+         ::close(fd);
+         THROWERROR("Could not map '" + path + "'");
+      }
+   }
+
+   // the mapping stays valid after closing the file
+   ::close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+   if (m_addr)
+      ::munmap(m_addr, m_size);
+}
+
+#else
+
+MappedFile::MappedFile(const std::string &path)
+   : m_path(path), m_addr(nullptr), m_size(0)
+{
+   THROWERROR_NOTIMPL_MSG("memory mapped files");
+}
+
+MappedFile::~MappedFile()
+{
+}
+
+#endif
+
+void MappedFile::check(std::uint64_t offset, std::uint64_t bytes, std::uint64_t align) const
+{
+   THROWERROR_ASSERT_MSG(offset <= m_size && bytes <= m_size - offset, "Mapped range outside of '" + m_path + "'");
+   THROWERROR_ASSERT_MSG(offset % align == 0, "Misaligned mapped range in '" + m_path + "'");
+}
+
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <string>
+#include <memory>
+#include <cstdint>
+
+#include <SmurffCpp/Types.h>
+
+namespace smurff {
+
+// Read-only memory mapping of a whole file.
+// Pages are shared with the page cache, hence with other processes mapping the same file.
+class MappedFile
+{
+private:
+   std::string m_path;
+   void *m_addr;
+   std::uint64_t m_size;
+
+public:
+   MappedFile(const std::string &path);
+   ~MappedFile();
+
+   MappedFile(const MappedFile &) = delete;
+   MappedFile &operator=(const MappedFile &) = delete;
+
+public:
+   const std::string &getPath() const { return m_path; }
+   std::uint64_t size() const { return m_size; }
+
+   // count elements of type T at byte offset in the file
+   template <typename T>
+   const T *data(std::uint64_t offset, std::uint64_t count) const
+   {
+      check(offset, count * sizeof(T), alignof(T));
+      return reinterpret_cast<const T *>(static_cast<const char *>(m_addr) + offset);
+   }
+
+private:
+   void check(std::uint64_t offset, std::uint64_t bytes, std::uint64_t align) const;
+};
+
+// A compressed sparse matrix and the CSC index of its transpose, in a mapped file.
+// Element i of column c (t_outer[c] <= i < t_outer[c+1]) is in row t_inner[i],
+// its value is values[t_perm[i]].
+struct MappedSparseMatrix
+{
+   typedef SparseMatrix::StorageIndex Index;
+
+   std::shared_ptr<const MappedFile> file;
+
+   Index rows = 0;
+   Index cols = 0;
+   Index nnz = 0;
+
+   const Index *outer = nullptr;
+   const Index *inner = nullptr;
+   const float_type *values = nullptr;
+
+   const Index *t_outer = nullptr;
+   const Index *t_inner = nullptr;
+   const Index *t_perm = nullptr;
+};
+
+}
@@ -0,0 +1,648 @@
+#include "MatrixIO.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include <SmurffCpp/Utils/MappedFile.h>
+#include <SmurffCpp/Utils/ThreadVector.hpp>
+#include <SmurffCpp/Utils/StringUtils.h>
+#include <SmurffCpp/Utils/Error.h>
+
+namespace smurff { namespace matrix_io {
+
+typedef SparseMatrix::StorageIndex StorageIndex;
+
+// files are split in at most this many chunks per thread, of at least MIN_CHUNK_SIZE bytes or entries
+static const int CHUNKS_PER_THREAD = 16;
+static const std::uint64_t MIN_CHUNK_SIZE = 1 << 16;
+
+static int num_chunks(std::uint64_t size)
+{
+   const std::uint64_t max_chunks = CHUNKS_PER_THREAD * threads::get_max_threads();
+   return std::max<std::uint64_t>(1, std::min(size / MIN_CHUNK_SIZE, max_chunks));
+}
+
+//
+// text parsing, on the mapped file
+//
+
+static bool is_blank(char c)
+{
+   return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+static const char *skip_separators(const char *p, const char *end)
+{
+   while (p < end && (is_blank(*p) || *p == ','))
+      ++p;
+   return p;
+}
+
+static bool at_separator(const char *p, const char *end)
+{
+   return p == end || is_blank(*p) || *p == ',';
+}
+
+// parses the integer at p, advancing p past it
+static bool parse_int(const char *&p, const char *end, std::int64_t &v)
+{
+   p = skip_separators(p, end);
+
+   bool negative = false;
+   if (p < end && (*p == '-' || *p == '+'))
+      negative = (*p++ == '-');
+
+   const char *digits = p;
+   std::int64_t r = 0;
+   while (p < end && *p >= '0' && *p <= '9')
+      r = r * 10 + (*p++ - '0');
+
+   v = negative ? -r : r;
+   return p > digits && at_separator(p, end);
+}
+
+// parses the floating point number at p, advancing p past it
+static bool parse_double(const char *&p, const char *end, double &v)
+{
+   p = skip_separators(p, end);
+
+   // the mapped text is not null-terminated, strtod needs a copy
+   char buf[64];
+   std::size_t n = 0;
+   while (p + n < end && !at_separator(p + n, end))
+   {
+      if (n == sizeof(buf) - 1)
+         return false;
+      buf[n] = p[n];
+      ++n;
+   }
+   buf[n] = '\0';
+
+   char *parsed;
+   v = std::strtod(buf, &parsed);
+   p += n;
+   return n > 0 && parsed == buf + n;
+}
+
+// finds the next line with data in [p, end), skipping blank lines and comments (% or #):
+// [line, eol) is the line without leading blanks, p moves past it
+static bool next_line(const char *&p, const char *end, const char *&line, const char *&eol)
+{
+   while (p < end)
+   {
+      eol = static_cast<const char *>(std::memchr(p, '\n', end - p));
+      if (!eol)
+         eol = end;
+
+      line = p;
+      while (line < eol && is_blank(*line))
+         ++line;
+
+      p = (eol < end) ? eol + 1 : end;
+
+      if (line < eol && *line != '%' && *line != '#')
+         return true;
+   }
+   return false;
+}
+
+template <typename F>
+static void for_each_line(const char *p, const char *end, F f)
+{
+   const char *line, *eol;
+   while (next_line(p, end, line, eol))
+      f(line, eol);
+}
+
+// splits [begin, end) in chunks of whole lines: chunk c is [bounds[c], bounds[c + 1])
+static std::vector<const char *> split_lines(const char *begin, const char *end)
+{
+   const std::uint64_t size = end - begin;
+   const int n = num_chunks(size);
+
+   std::vector<const char *> bounds(1, begin);
+   for (int c = 1; c < n; ++c)
+   {
+      const char *p = std::max(bounds.back(), begin + size * c / n);
+      const char *eol = static_cast<const char *>(std::memchr(p, '\n', end - p));
+      if (!eol)
+         break;
+      bounds.push_back(eol + 1);
+   }
+   bounds.push_back(end);
+
+   return bounds;
+}
+
+// calls f(k, line, eol) for the k'th line with data in [begin, end), in parallel
+// f returns false for a malformed line
+template <typename F>
+static void for_each_record(const char *begin, const char *end, std::uint64_t nrecords, const std::string &filename, F f)
+{
+   const std::vector<const char *> bounds = split_lines(begin, end);
+   const int nchunks = bounds.size() - 1;
+
+   // index of the first line of every chunk
+   std::vector<std::uint64_t> first(nchunks + 1, 0);
+
+   #pragma omp parallel for schedule(dynamic, 1)
+   for (int c = 0; c < nchunks; ++c)
+      for_each_line(bounds[c], bounds[c + 1], [&](const char *, const char *) { first[c + 1]++; });
+
+   std::partial_sum(first.begin(), first.end(), first.begin());
+   THROWERROR_ASSERT_MSG(first[nchunks] == nrecords,
+      "Expected " + std::to_string(nrecords) + " lines of values in '" + filename + "', found " + std::to_string(first[nchunks]));
+
+   std::uint64_t bad = 0;
+
+   #pragma omp parallel for schedule(dynamic, 1) reduction(+:bad)
+   for (int c = 0; c < nchunks; ++c)
+   {
+      std::uint64_t k = first[c];
+      for_each_line(bounds[c], bounds[c + 1], [&](const char *line, const char *eol) {
+         if (!f(k++, line, eol))
+            bad++;
+      });
+   }
+
+   THROWERROR_ASSERT_MSG(bad == 0, std::to_string(bad) + " malformed lines in '" + filename + "'");
+}
+
+static std::string to_lower(std::string s)
+{
+   std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c) { return std::tolower(c); });
+   return s;
+}
+
+//
+// sparse matrices
+//
+// A source of entries is split in chunks() chunks, for chunk c
+//  - indices(c, f, records) calls f(row, col) for every entry, f returns false when the entry is out of range,
+//    and adds the number of records (lines or binary entries) of the chunk to records
+//  - entries(c, f) calls f(row, col, value) for every entry
+// both return the number of malformed entries
+//
+
+// entries of a .sdm or .sbm file
+struct BinarySource
+{
+   const std::int32_t *rows;
+   const std::int32_t *cols;
+   const double *values; // nullptr for .sbm
+   std::uint64_t nnz;
+   int nchunks;
+
+   int chunks() const { return nchunks; }
+
+   std::uint64_t begin(int c) const { return nnz * c / nchunks; }
+
+   template <typename F>
+   std::uint64_t indices(int c, F f, std::uint64_t &records) const
+   {
+      std::uint64_t bad = 0;
+      for (std::uint64_t i = begin(c); i < begin(c + 1); ++i)
+         if (!f(rows[i] - 1, cols[i] - 1))
+            bad++;
+      records += begin(c + 1) - begin(c);
+      return bad;
+   }
+
+   template <typename F>
+   std::uint64_t entries(int c, F f) const
+   {
+      for (std::uint64_t i = begin(c); i < begin(c + 1); ++i)
+         f(rows[i] - 1, cols[i] - 1, values ? values[i] : 1.0);
+      return 0;
+   }
+};
+
+// entries of a text file, one per line
+struct TextSource
+{
+   std::vector<const char *> bounds;
+   int base;        // index of the first row and col: 1 for Matrix Market, 0 for csv
+   bool has_values; // without values, all values are 1
+   bool symmetric;  // entries off the diagonal also stand for their mirror
+
+   int chunks() const { return bounds.size() - 1; }
+
+   template <typename F>
+   std::uint64_t indices(int c, F f, std::uint64_t &records) const
+   {
+      std::uint64_t bad = 0;
+      for_each_line(bounds[c], bounds[c + 1], [&](const char *p, const char *eol) {
+         records++;
+
+         std::int64_t row, col;
+         if (!parse_int(p, eol, row) || !parse_int(p, eol, col))
+         {
+            bad++;
+            return;
+         }
+
+         row -= base;
+         col -= base;
+         if (!f(row, col) || (symmetric && row != col && !f(col, row)))
+            bad++;
+      });
+      return bad;
+   }
+
+   template <typename F>
+   std::uint64_t entries(int c, F f) const
+   {
+      std::uint64_t bad = 0;
+      for_each_line(bounds[c], bounds[c + 1], [&](const char *p, const char *eol) {
+         std::int64_t row, col;
+         double value = 1.0;
+         if (!parse_int(p, eol, row) || !parse_int(p, eol, col) || (has_values && !parse_double(p, eol, value)))
+         {
+            bad++;
+            return;
+         }
+
+         row -= base;
+         col -= base;
+         f(row, col, value);
+         if (symmetric && row != col)
+            f(col, row, value);
+      });
+      return bad;
+   }
+};
+
+static void check_size(std::int64_t nrow, std::int64_t ncol, const std::string &filename)
+{
+   const std::int64_t max = std::numeric_limits<StorageIndex>::max();
+   THROWERROR_ASSERT_MSG(nrow >= 0 && ncol >= 0 && nrow < max && ncol < max,
+      "Invalid matrix size " + std::to_string(nrow) + " x " + std::to_string(ncol) + " in '" + filename + "'");
+}
+
+// nrecords: the number of records the file declares, -1 when it does not
+template <typename Source>
+static SparseMatrix build_csr(const Source &src, std::int64_t nrow, std::int64_t ncol, const std::string &filename, std::int64_t nrecords = -1)
+{
+   check_size(nrow, ncol, filename);
+
+   SparseMatrix Y(nrow, ncol);
+   StorageIndex *outer = Y.outerIndexPtr(); // all zero
+
+   // count the entries of every row in outer[row + 1]
+   std::uint64_t bad = 0, records = 0;
+
+   #pragma omp parallel for schedule(dynamic, 1) reduction(+:bad,records)
+   for (int c = 0; c < src.chunks(); ++c)
+   {
+      bad += src.indices(c, [&](std::int64_t row, std::int64_t col) {
+         if (row < 0 || row >= nrow || col < 0 || col >= ncol)
+            return false;
+
+         #pragma omp atomic
+         outer[row + 1]++;
+
+         return true;
+      }, records);
+   }
+
+   THROWERROR_ASSERT_MSG(nrecords < 0 || records == (std::uint64_t)nrecords,
+      "Expected " + std::to_string(nrecords) + " entries in '" + filename + "', found " + std::to_string(records));
+   THROWERROR_ASSERT_MSG(bad == 0, std::to_string(bad) + " malformed or out of range entries in '" + filename + "'");
+
+   std::uint64_t nnz = 0;
+   for (std::int64_t row = 0; row < nrow; ++row)
+   {
+      nnz += outer[row + 1];
+      THROWERROR_ASSERT_MSG(nnz <= (std::uint64_t)std::numeric_limits<StorageIndex>::max(),
+         "Too many entries in '" + filename + "': a sparse matrix holds at most " + std::to_string(std::numeric_limits<StorageIndex>::max()));
+      outer[row + 1] = nnz;
+   }
+
+   // scatter the entries to their row
+   Y.resizeNonZeros(nnz);
+   StorageIndex *inner = Y.innerIndexPtr();
+   float_type *values = Y.valuePtr();
+   std::vector<StorageIndex> next(outer, outer + nrow);
+
+   #pragma omp parallel for schedule(dynamic, 1) reduction(+:bad)
+   for (int c = 0; c < src.chunks(); ++c)
+   {
+      bad += src.entries(c, [&](std::int64_t row, std::int64_t col, double value) {
+         StorageIndex p;
+
+         #pragma omp atomic capture
+         p = next[row]++;
+
+         inner[p] = col;
+         values[p] = value;
+      });
+   }
+
+   THROWERROR_ASSERT_MSG(bad == 0, std::to_string(bad) + " malformed entries in '" + filename + "'");
+
+   // sort every row by column and sum duplicates
+   // rows are sorted by (col, value), so sums do not depend on the order of scattering
+   std::vector<StorageIndex> row_nnz(nrow);
+   thread_vector<std::vector<std::pair<StorageIndex, float_type>>> scratch;
+
+   #pragma omp parallel for schedule(dynamic, 1024)
+   for (std::int64_t row = 0; row < nrow; ++row)
+   {
+      const StorageIndex b = outer[row];
+      const StorageIndex e = outer[row + 1];
+
+      if (std::adjacent_find(inner + b, inner + e, std::greater_equal<StorageIndex>()) == inner + e)
+      {
+         row_nnz[row] = e - b;
+         continue;
+      }
+
+      auto &entries = scratch.local();
+      entries.clear();
+      for (StorageIndex i = b; i < e; ++i)
+         entries.emplace_back(inner[i], values[i]);
+      std::sort(entries.begin(), entries.end());
+
+      StorageIndex n = b;
+      for (const auto &entry : entries)
+      {
+         if (n > b && inner[n - 1] == entry.first)
+         {
+            values[n - 1] += entry.second;
+         }
+         else
+         {
+            inner[n] = entry.first;
+            values[n] = entry.second;
+            n++;
+         }
+      }
+      row_nnz[row] = n - b;
+   }
+
+   // close the gaps left by duplicates
+   if (std::accumulate(row_nnz.begin(), row_nnz.end(), (std::uint64_t)0) < nnz)
+   {
+      StorageIndex n = 0;
+      for (std::int64_t row = 0; row < nrow; ++row)
+      {
+         const StorageIndex b = outer[row];
+         std::memmove(inner + n, inner + b, row_nnz[row] * sizeof(StorageIndex));
+         std::memmove(values + n, values + b, row_nnz[row] * sizeof(float_type));
+         outer[row] = n;
+         n += row_nnz[row];
+      }
+      outer[nrow] = n;
+      Y.resizeNonZeros(n);
+   }
+
+   return Y;
+}
+
+static SparseMatrix read_sparse_binary(const MappedFile &file, bool has_values)
+{
+   const std::string &filename = file.getPath();
+   const std::int64_t *header = file.data<std::int64_t>(0, 3);
+   const std::int64_t nrow = header[0];
+   const std::int64_t ncol = header[1];
+   const std::int64_t nnz = header[2];
+   THROWERROR_ASSERT_MSG(nnz >= 0, "Invalid number of entries in '" + filename + "'");
+
+   std::uint64_t offset = 3 * sizeof(std::int64_t);
+   BinarySource src;
+   src.rows = file.data<std::int32_t>(offset, nnz);
+   offset += nnz * sizeof(std::int32_t);
+   src.cols = file.data<std::int32_t>(offset, nnz);
+   offset += nnz * sizeof(std::int32_t);
+   src.values = has_values ? file.data<double>(offset, nnz) : nullptr;
+   src.nnz = nnz;
+   src.nchunks = num_chunks(nnz);
+
+   return build_csr(src, nrow, ncol, filename);
+}
+
+static Matrix read_dense_float64(const MappedFile &file)
+{
+   const std::string &filename = file.getPath();
+   const std::int64_t *header = file.data<std::int64_t>(0, 2);
+   const std::int64_t nrow = header[0];
+   const std::int64_t ncol = header[1];
+   check_size(nrow, ncol, filename);
+
+   typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor> ColMajorMatrix;
+   const Eigen::Map<const ColMajorMatrix> values(file.data<double>(2 * sizeof(std::int64_t), nrow * ncol), nrow, ncol);
+
+   Matrix Y(nrow, ncol);
+
+   #pragma omp parallel for schedule(static)
+   for (std::int64_t row = 0; row < nrow; ++row)
+      Y.row(row) = values.row(row).cast<float_type>();
+
+   return Y;
+}
+
+Matrix read_dense_float64(const std::string& filename)
+{
+   return read_dense_float64(MappedFile(filename));
+}
+
+SparseMatrix read_sparse_float64(const std::string& filename)
+{
+   return read_sparse_binary(MappedFile(filename), true);
+}
+
+SparseMatrix read_sparse_binary_matrix(const std::string& filename)
+{
+   return read_sparse_binary(MappedFile(filename), false);
+}
+
+void read_matrix_market(const std::string& filename, bool isScarce, DataConfig& dataConfig)
+{
+   read_matrix_market(MappedFile(filename), isScarce, dataConfig);
+}
+
+void read_matrix_market(const MappedFile& file, bool isScarce, DataConfig& dataConfig)
+{
+   const std::string &filename = file.getPath();
+   THROWERROR_ASSERT_MSG(file.size() > 0, "Empty file '" + filename + "'");
+
+   const char *p = file.data<char>(0, file.size());
+   const char *end = p + file.size();
+
+   // %%MatrixMarket matrix <format> <field> <symmetry>
+   const char *eol = static_cast<const char *>(std::memchr(p, '\n', end - p));
+   if (!eol)
+      eol = end;
+   std::istringstream banner(to_lower(std::string(p, eol)));
+   p = (eol < end) ? eol + 1 : end;
+
+   std::string tag, object, format, field, symmetry;
+   banner >> tag >> object >> format >> field >> symmetry;
+   THROWERROR_ASSERT_MSG(tag == "%%matrixmarket" && object == "matrix", "Not a Matrix Market matrix: '" + filename + "'");
+
+   const bool coordinate = (format == "coordinate");
+   if (!coordinate && format != "array")
+      THROWERROR_NOTIMPL_MSG("Matrix Market format '" + format + "' in '" + filename + "'");
+   if (field != "real" && field != "integer" && field != "double" && !(coordinate && field == "pattern"))
+      THROWERROR_NOTIMPL_MSG("Matrix Market field '" + field + "' in '" + filename + "'");
+   if (symmetry != "general" && !(coordinate && symmetry == "symmetric"))
+      THROWERROR_NOTIMPL_MSG("Matrix Market symmetry '" + symmetry + "' in '" + filename + "'");
+
+   const char *line;
+   THROWERROR_ASSERT_MSG(next_line(p, end, line, eol), "Missing size line in '" + filename + "'");
+
+   std::int64_t nrow, ncol, nnz = 0;
+   THROWERROR_ASSERT_MSG(parse_int(line, eol, nrow) && parse_int(line, eol, ncol) && (!coordinate || (parse_int(line, eol, nnz) && nnz >= 0)),
+      "Invalid size line in '" + filename + "'");
+
+   if (coordinate)
+   {
+      TextSource src;
+      src.bounds = split_lines(p, end);
+      src.base = 1;
+      src.has_values = (field != "pattern");
+      src.symmetric = (symmetry == "symmetric");
+
+      // a truncated file has fewer entries than its size line
+      dataConfig.setData(build_csr(src, nrow, ncol, filename, nnz), isScarce);
+   }
+   else
+   {
+      check_size(nrow, ncol, filename);
+      Matrix Y(nrow, ncol);
+
+      // one value per line, in column-major order
+      for_each_record(p, end, nrow * ncol, filename, [&](std::uint64_t k, const char *b, const char *e) {
+         double value;
+         if (!parse_double(b, e, value) || skip_separators(b, e) != e)
+            return false;
+         Y(k % nrow, k / nrow) = value;
+         return true;
+      });
+
+      dataConfig.setData(std::move(Y));
+   }
+}
+
+void read_csv(const std::string& filename, bool isScarce, DataConfig& dataConfig, std::int64_t nrow_hint, std::int64_t ncol_hint)
+{
+   read_csv(MappedFile(filename), isScarce, dataConfig, nrow_hint, ncol_hint);
+}
+
+void read_csv(const MappedFile& file, bool isScarce, DataConfig& dataConfig, std::int64_t nrow_hint, std::int64_t ncol_hint)
+{
+   const std::string &filename = file.getPath();
+   THROWERROR_ASSERT_MSG(file.size() > 0, "Empty file '" + filename + "'");
+
+   const char *p = file.data<char>(0, file.size());
+   const char *end = p + file.size();
+
+   const char *body = p;
+   const char *line, *eol;
+   THROWERROR_ASSERT_MSG(next_line(p, end, line, eol), "No data in '" + filename + "'");
+
+   // dense: a line with only the number of rows
+   std::int64_t nrow, ncol;
+   if (parse_int(line, eol, nrow) && skip_separators(line, eol) == eol)
+   {
+      THROWERROR_ASSERT_MSG(next_line(p, end, line, eol) && parse_int(line, eol, ncol) && skip_separators(line, eol) == eol,
+         "Missing number of columns in '" + filename + "'");
+      check_size(nrow, ncol, filename);
+
+      Matrix Y(nrow, ncol);
+
+      // one row per line
+      for_each_record(p, end, nrow, filename, [&](std::uint64_t row, const char *b, const char *e) {
+         for (std::int64_t col = 0; col < ncol; ++col)
+         {
+            double value;
+            if (!parse_double(b, e, value))
+               return false;
+            Y(row, col) = value;
+         }
+         return skip_separators(b, e) == e;
+      });
+
+      dataConfig.setData(std::move(Y));
+      return;
+   }
+
+   // triplets, after an optional header line
+   p = body;
+   next_line(p, end, line, eol);
+   const char *first = body;
+   if (!std::isdigit((unsigned char)*line) && *line != '+' && *line != '-')
+   {
+      first = p;
+      THROWERROR_ASSERT_MSG(next_line(p, end, line, eol), "No data in '" + filename + "'");
+   }
+
+   std::int64_t row, col;
+   THROWERROR_ASSERT_MSG(parse_int(line, eol, row) && parse_int(line, eol, col), "Expected row and col in '" + filename + "'");
+
+   TextSource src;
+   src.bounds = split_lines(first, end);
+   src.base = 0;
+   src.has_values = (skip_separators(line, eol) != eol);
+   src.symmetric = false;
+
+   // size of the matrix from the hints, else from the largest indices
+   nrow = nrow_hint;
+   ncol = ncol_hint;
+   if (nrow < 0 || ncol < 0)
+   {
+      std::int64_t max_row = -1, max_col = -1;
+      std::uint64_t records = 0;
+
+      #pragma omp parallel for schedule(dynamic, 1) reduction(max:max_row,max_col) reduction(+:records)
+      for (int c = 0; c < src.chunks(); ++c)
+      {
+         src.indices(c, [&](std::int64_t row, std::int64_t col) {
+            max_row = std::max(max_row, row);
+            max_col = std::max(max_col, col);
+            return true;
+         }, records);
+      }
+
+      if (nrow < 0)
+         nrow = max_row + 1;
+      if (ncol < 0)
+         ncol = max_col + 1;
+   }
+
+   dataConfig.setData(build_csr(src, nrow, ncol, filename), isScarce);
+}
+
+void read_matrix(const std::string& filename, bool isScarce, DataConfig& dataConfig, std::int64_t nrow_hint, std::int64_t ncol_hint)
+{
+   read_matrix(MappedFile(filename), isScarce, dataConfig, nrow_hint, ncol_hint);
+}
+
+void read_matrix(const MappedFile& file, bool isScarce, DataConfig& dataConfig, std::int64_t nrow_hint, std::int64_t ncol_hint)
+{
+   const std::string &filename = file.getPath();
+   const std::string extension = to_lower(fileExtension(filename));
+
+   if (extension == ".ddm")
+      dataConfig.setData(read_dense_float64(file));
+   else if (extension == ".sdm")
+      dataConfig.setData(read_sparse_binary(file, true), isScarce);
+   else if (extension == ".sbm")
+      dataConfig.setData(read_sparse_binary(file, false), isScarce);
+   else if (extension == ".mtx" || extension == ".mm")
+      read_matrix_market(file, isScarce, dataConfig);
+   else if (extension == ".csv")
+      read_csv(file, isScarce, dataConfig, nrow_hint, ncol_hint);
+   else
+      THROWERROR("Unknown matrix file extension '" + extension + "' of '" + filename + "'");
+}
+
+}}
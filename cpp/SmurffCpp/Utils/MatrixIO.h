@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <SmurffCpp/Types.h>
+#include <SmurffCpp/Configs/DataConfig.h>
+
+namespace smurff {
+
+class MappedFile;
+
+namespace matrix_io {
+
+// Readers for the matrix files of python/smurff/matrix_io.py, selected by extension.
+//
+// Files are mapped and parsed in chunks, in parallel. Sparse matrices are built
+// in CSR form directly: entries are counted per row, scattered to their row, and
+// every row is sorted by column. Duplicate entries are summed.
+//
+// SparseMatrix has an int StorageIndex: a sparse matrix holds at most 2^31 - 1
+// entries, larger files (e.g. billions of triplets) are rejected with an error.
+
+// .ddm: int64 nrow, ncol, then nrow * ncol doubles in column-major order
+Matrix read_dense_float64(const std::string& filename);
+
+// .sdm: int64 nrow, ncol, nnz, then nnz int32 rows, nnz int32 cols (1-based) and nnz doubles
+SparseMatrix read_sparse_float64(const std::string& filename);
+
+// .sbm: as .sdm without the doubles, all values are 1
+SparseMatrix read_sparse_binary_matrix(const std::string& filename);
+
+// .mtx, .mm: Matrix Market coordinate (real, integer or pattern; general or symmetric)
+// or array (real or integer; general); a coordinate file must have the number of
+// entries given on its size line
+void read_matrix_market(const std::string& filename, bool isScarce, DataConfig& dataConfig);
+void read_matrix_market(const MappedFile& file, bool isScarce, DataConfig& dataConfig);
+
+// .csv: comma or blank separated, either
+//  - nrow and ncol on the first two lines, then nrow lines of ncol values (as written by matrix_io.py)
+//  - COO triplets: lines of row, col and optionally value (0-based), after an optional header line;
+//    triplets do not store the size of the matrix: it is nrow_hint x ncol_hint, each taken from
+//    the largest row or col when negative
+void read_csv(const std::string& filename, bool isScarce, DataConfig& dataConfig,
+              std::int64_t nrow_hint = -1, std::int64_t ncol_hint = -1);
+void read_csv(const MappedFile& file, bool isScarce, DataConfig& dataConfig,
+              std::int64_t nrow_hint = -1, std::int64_t ncol_hint = -1);
+
+// any of the above, by file extension; the hints are only used by files without a size
+void read_matrix(const std::string& filename, bool isScarce, DataConfig& dataConfig,
+                 std::int64_t nrow_hint = -1, std::int64_t ncol_hint = -1);
+
+// the same, from a file that is already mapped
+void read_matrix(const MappedFile& file, bool isScarce, DataConfig& dataConfig,
+                 std::int64_t nrow_hint = -1, std::int64_t ncol_hint = -1);
+
+}}
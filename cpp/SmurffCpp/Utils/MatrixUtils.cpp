@@ -47,6 +47,39 @@ SparseMatrix matrix_utils::make_sparse(
    return sparse_to_eigen(smurff::SparseTensor(dims, columns, values));
 }
 
+void matrix_utils::transposed_index(const SparseMatrixMap &Y,
+    std::vector<SparseMatrix::StorageIndex> &outer,
+    std::vector<SparseMatrix::StorageIndex> &inner,
+    std::vector<SparseMatrix::StorageIndex> &perm)
+{
+   typedef SparseMatrix::StorageIndex Index;
+
+   const Index nnz = Y.nonZeros();
+   const Index *Y_outer = Y.outerIndexPtr();
+   const Index *Y_inner = Y.innerIndexPtr();
+
+   // counting sort of the elements by column
+   outer.assign(Y.cols() + 1, 0);
+   for (Index i = 0; i < nnz; ++i)
+      outer[Y_inner[i] + 1]++;
+   for (Index c = 0; c < Y.cols(); ++c)
+      outer[c + 1] += outer[c];
+
+   std::vector<Index> next(outer.begin(), outer.end() - 1);
+   inner.resize(nnz);
+   perm.resize(nnz);
+
+   for (Index r = 0; r < Y.rows(); ++r)
+   {
+      for (Index i = Y_outer[r]; i < Y_outer[r + 1]; ++i)
+      {
+         const Index p = next[Y_inner[i]]++;
+         inner[p] = r;
+         perm[p] = i;
+      }
+   }
+}
+
 bool matrix_utils::equals(const Matrix& m1, const Matrix& m2, double epsilon)
 {
    if (m1.rows() != m2.rows() || m1.cols() != m2.cols())
@@ -66,6 +66,14 @@ namespace smurff { namespace matrix_utils {
           const std::vector<double> &values
    );
 
+   // CSC index of a compressed CSR matrix: per column the rows of its elements
+   // and the positions of their values in Y
+   void transposed_index(const SparseMatrixMap &Y,
+          std::vector<SparseMatrix::StorageIndex> &outer,
+          std::vector<SparseMatrix::StorageIndex> &inner,
+          std::vector<SparseMatrix::StorageIndex> &perm
+   );
+
    bool equals(const Matrix& m1, const Matrix& m2, double epsilon = std::numeric_limits<double>::epsilon());
    bool equals_vector(const Vector& v1, const Vector& v2, double epsilon = std::numeric_limits<double>::epsilon() * 100);
 }}
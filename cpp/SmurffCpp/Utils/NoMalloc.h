@@ -0,0 +1,54 @@
+#pragma once
+
+// Checks that a piece of code does no heap allocation through Eigen.
+//
+// Debug builds (_DEBUG) define EIGEN_RUNTIME_NO_MALLOC, so every Eigen heap
+// allocation -- matrix storage, but also the blocking buffers of the product
+// kernels -- first checks Eigen::internal::is_malloc_allowed(). Inside a
+// NoMalloc scope that check fails with an eigen_assert. Release builds do not
+// check.
+//
+// Must be included before any Eigen header, so all code sees the same setting.
+
+#if defined(_DEBUG) && !defined(EIGEN_RUNTIME_NO_MALLOC)
+#define EIGEN_RUNTIME_NO_MALLOC
+#endif
+
+#include <Eigen/Core>
+
+namespace smurff {
+
+// forbids Eigen heap allocations until the end of the scope
+//
+// The flag is process wide: other threads must not allocate either.
+class NoMalloc
+{
+#ifdef EIGEN_RUNTIME_NO_MALLOC
+private:
+   bool m_was_allowed;
+
+public:
+   NoMalloc() : m_was_allowed(Eigen::internal::is_malloc_allowed())
+   {
+      Eigen::internal::set_is_malloc_allowed(false);
+   }
+
+   ~NoMalloc()
+   {
+      Eigen::internal::set_is_malloc_allowed(m_was_allowed);
+   }
+#endif
+
+public:
+   // true when allocations are checked, i.e. in debug builds
+   static bool enabled()
+   {
+#ifdef EIGEN_RUNTIME_NO_MALLOC
+      return true;
+#else
+      return false;
+#endif
+   }
+};
+
+} // end namespace smurff
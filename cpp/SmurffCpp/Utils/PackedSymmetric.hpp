@@ -0,0 +1,69 @@
+#pragma once
+
+#include <type_traits>
+
+#include <SmurffCpp/Types.h>
+#include <SmurffCpp/Utils/Error.h>
+
+// Symmetric K x K matrices stored as their lower triangle, packed row by row
+// in a single row vector: (0,0), (1,0), (1,1), (2,0), (2,1), (2,2), ...
+// This takes K(K+1)/2 entries instead of K*K.
+
+namespace smurff {
+namespace packed {
+
+inline Eigen::Index size(Eigen::Index K)
+{
+   return K * (K + 1) / 2;
+}
+
+// P += v' * v
+template <typename Packed, typename VectorType>
+void rank_update(Packed &&P, const VectorType &v)
+{
+   typedef typename std::decay<Packed>::type::Scalar Scalar;
+
+   Eigen::Index idx = 0;
+   for (Eigen::Index r = 0; r < v.size(); ++r)
+   {
+      P.segment(idx, r + 1) += (v(r) * v.head(r + 1)).template cast<Scalar>();
+      idx += r + 1;
+   }
+}
+
+// P = lower triangle of M
+template <typename Packed, typename MatrixType>
+void pack(Packed &&P, const MatrixType &M)
+{
+   typedef typename std::decay<Packed>::type::Scalar Scalar;
+
+   Eigen::Index idx = 0;
+   for (Eigen::Index r = 0; r < M.rows(); ++r)
+   {
+      P.segment(idx, r + 1) = M.row(r).head(r + 1).template cast<Scalar>();
+      idx += r + 1;
+   }
+}
+
+// M = full K x K symmetric matrix stored in P
+template <typename Packed>
+void unpack(Matrix &M, const Packed &P, Eigen::Index K)
+{
+   THROWERROR_ASSERT(P.size() == size(K));
+
+   M.resize(K, K);
+   Eigen::Index idx = 0;
+   for (Eigen::Index r = 0; r < K; ++r)
+      for (Eigen::Index c = 0; c <= r; ++c, ++idx)
+         M(r, c) = M(c, r) = P(idx);
+}
+
+inline Matrix unpack(const AggrMatrix &P, Eigen::Index row, Eigen::Index K)
+{
+   Matrix M;
+   unpack(M, P.row(row), K);
+   return M;
+}
+
+} // end namespace packed
+} // end namespace smurff
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <SmurffCpp/Utils/Error.h>
+
+namespace smurff {
+
+// Loads items 0 .. count-1 on a background thread, in order, ahead of the caller.
+//
+// The prefetcher owns a fixed set of buffers: next returns the next item and keeps
+// it until the following call, the other buffers hold items loaded ahead. The
+// loader waits while all buffers are full, so at most that many items are in memory.
+//
+// An exception thrown by load is rethrown by next once the items loaded before it
+// have been returned.
+template <typename Item>
+class Prefetcher
+{
+private:
+   std::function<void(std::size_t, Item &)> m_load;
+
+   std::vector<Item> m_buffers; // item i is in m_buffers[i % size]
+   std::size_t m_count;
+   std::size_t m_loaded;   // items loaded
+   std::size_t m_returned; // items returned by next
+   bool m_stop;
+   std::exception_ptr m_error;
+
+   std::mutex m_mutex;
+   std::condition_variable m_cond;
+   std::thread m_thread;
+
+public:
+   Prefetcher(std::size_t nbuffers, std::size_t count, std::function<void(std::size_t, Item &)> load)
+      : m_load(load), m_buffers(nbuffers), m_count(count), m_loaded(0), m_returned(0), m_stop(false)
+   {
+      THROWERROR_ASSERT(nbuffers > 0);
+      m_thread = std::thread(&Prefetcher::run, this);
+   }
+
+   // stops loading, after the item being loaded
+   ~Prefetcher()
+   {
+      {
+         std::lock_guard<std::mutex> lock(m_mutex);
+         m_stop = true;
+      }
+      m_cond.notify_all();
+      m_thread.join();
+   }
+
+   Prefetcher(const Prefetcher &) = delete;
+   Prefetcher &operator=(const Prefetcher &) = delete;
+
+public:
+   std::size_t count() const { return m_count; }
+
+   // the next item, waits until it is loaded; the item returned before is released
+   Item &next()
+   {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      THROWERROR_ASSERT_MSG(m_returned < m_count, "Prefetcher: no items left");
+
+      ++m_returned;
+      m_cond.notify_all();
+
+      m_cond.wait(lock, [this] { return m_loaded >= m_returned || m_error; });
+      if (m_loaded < m_returned)
+         std::rethrow_exception(m_error);
+
+      return m_buffers[(m_returned - 1) % m_buffers.size()];
+   }
+
+private:
+   // first item still held by the caller or not yet returned
+   std::size_t inUse() const
+   {
+      return m_returned ? m_returned - 1 : 0;
+   }
+
+   void run()
+   {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      while (m_loaded < m_count)
+      {
+         m_cond.wait(lock, [this] { return m_stop || m_loaded - inUse() < m_buffers.size(); });
+         if (m_stop)
+            return;
+
+         const std::size_t i = m_loaded;
+         lock.unlock();
+
+         std::exception_ptr error;
+         try
+         {
+            m_load(i, m_buffers[i % m_buffers.size()]);
+         }
+         catch (...)
+         {
+            error = std::current_exception();
+         }
+
+         lock.lock();
+         if (error)
+         {
+            m_error = error;
+            m_cond.notify_all();
+            return;
+         }
+
+         ++m_loaded;
+         m_cond.notify_all();
+      }
+   }
+};
+
+}
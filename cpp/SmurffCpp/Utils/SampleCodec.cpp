@@ -0,0 +1,124 @@
+#include "SampleCodec.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace smurff { namespace sample_codec {
+
+static const double HALF_MAX = 65504.0;
+
+std::uint16_t to_half(float value)
+{
+   std::uint32_t x;
+   std::memcpy(&x, &value, sizeof(x));
+
+   const std::uint16_t sign = (x >> 16) & 0x8000;
+   const std::uint32_t abs = x & 0x7fffffff;
+
+   if (abs >= 0x7f800000) // inf, nan
+      return sign | 0x7c00 | (abs > 0x7f800000 ? 0x200 : 0);
+
+   if (abs >= 0x477ff000) // 65520 and up round to inf
+      return sign | 0x7c00;
+
+   if (abs < 0x33000000) // below 2^-25, rounds to 0
+      return sign;
+
+   std::uint32_t h, rem, halfway;
+   if (abs < 0x38800000)
+   {
+      // subnormal: multiples of 2^-24
+      const std::uint32_t shift = 126 - (abs >> 23);
+      const std::uint32_t mantissa = (abs & 0x7fffff) | 0x800000;
+      h = mantissa >> shift;
+      rem = mantissa & ((1u << shift) - 1);
+      halfway = 1u << (shift - 1);
+   }
+   else
+   {
+      // rebias the exponent from 127 to 15, keep the top 10 bits of the mantissa
+      h = (abs - 0x38000000) >> 13;
+      rem = abs & 0x1fff;
+      halfway = 0x1000;
+   }
+
+   if (rem > halfway || (rem == halfway && (h & 1)))
+      ++h; // a carry into the exponent is still the right value
+
+   return sign | h;
+}
+
+float from_half(std::uint16_t value)
+{
+   const std::uint32_t sign = static_cast<std::uint32_t>(value & 0x8000) << 16;
+   const std::uint32_t exponent = (value >> 10) & 0x1f;
+   const std::uint32_t mantissa = value & 0x3ff;
+
+   std::uint32_t x;
+   if (exponent == 0x1f)
+      x = sign | 0x7f800000 | (mantissa << 13);
+   else if (exponent != 0)
+      x = sign | ((exponent + 112) << 23) | (mantissa << 13);
+   else
+   {
+      const float f = std::ldexp(static_cast<float>(mantissa), -24);
+      return sign ? -f : f;
+   }
+
+   float f;
+   std::memcpy(&f, &x, sizeof(f));
+   return f;
+}
+
+bool encode_float16(const Matrix &M, std::vector<std::uint16_t> &data, double &max_error)
+{
+   data.clear();
+   max_error = 0.0;
+
+   if (M.size() && !(M.array().abs() <= HALF_MAX).all()) // false for nan too
+      return false;
+
+   data.resize(M.size());
+   const float_type *in = M.data();
+   for (Eigen::Index i = 0; i < M.size(); ++i)
+   {
+      data[i] = to_half(static_cast<float>(in[i]));
+      max_error = std::max(max_error, std::abs(static_cast<double>(from_half(data[i])) - in[i]));
+   }
+
+   return true;
+}
+
+void encode_uint8(const Matrix &M, std::vector<std::uint8_t> &data, std::vector<double> &scale, std::vector<double> &offset, double &max_error)
+{
+   const Eigen::Index ncols = M.cols();
+
+   offset.assign(ncols, 0.0);
+   scale.assign(ncols, 0.0);
+   if (M.rows())
+   {
+      for (Eigen::Index j = 0; j < ncols; ++j)
+      {
+         offset[j] = M.col(j).minCoeff();
+         scale[j] = (static_cast<double>(M.col(j).maxCoeff()) - offset[j]) / 255.0;
+      }
+   }
+
+   data.resize(M.size());
+   max_error = 0.0;
+
+   #pragma omp parallel for schedule(static) reduction(max:max_error)
+   for (Eigen::Index i = 0; i < M.rows(); ++i)
+   {
+      for (Eigen::Index j = 0; j < ncols; ++j)
+      {
+         const double x = M(i, j);
+         const double q = scale[j] > 0.0 ? std::min(255.0, std::max(0.0, std::round((x - offset[j]) / scale[j]))) : 0.0;
+         data[i * ncols + j] = static_cast<std::uint8_t>(q);
+         max_error = std::max(max_error, std::abs(offset[j] + scale[j] * q - x));
+      }
+   }
+}
+
+}}
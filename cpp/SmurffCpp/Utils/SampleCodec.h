@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <SmurffCpp/Types.h>
+#include <SmurffCpp/Utils/Error.h>
+
+namespace smurff { namespace sample_codec {
+
+// Lossy encodings of the latent matrices of saved samples, see HDF5Group::write.
+// Values are stored row-major, in the layout of the matrix.
+
+// IEEE 754 binary16, rounded to nearest even
+std::uint16_t to_half(float value);
+float from_half(std::uint16_t value);
+
+// float16: relative error at most 2^-11 (absolute 2^-25 below 2^-14)
+// returns false, with data empty, when a value is not finite or does not fit (|x| > 65504)
+bool encode_float16(const Matrix &M, std::vector<std::uint16_t> &data, double &max_error);
+
+// uint8: per column j, M(i, j) ~ offset[j] + scale[j] * data[i * cols + j],
+// with offset and scale from the range of the column; the error is at most scale[j] / 2
+void encode_uint8(const Matrix &M, std::vector<std::uint8_t> &data, std::vector<double> &scale, std::vector<double> &offset, double &max_error);
+
+template <typename Scalar>
+void decode_float16(const std::vector<std::uint16_t> &data, Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> &M)
+{
+   THROWERROR_ASSERT(data.size() == static_cast<std::size_t>(M.size()));
+   Scalar *out = M.data();
+   for (std::size_t i = 0; i < data.size(); ++i)
+      out[i] = from_half(data[i]);
+}
+
+template <typename Scalar>
+void decode_uint8(const std::vector<std::uint8_t> &data, const std::vector<double> &scale, const std::vector<double> &offset,
+                  Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> &M)
+{
+   THROWERROR_ASSERT(data.size() == static_cast<std::size_t>(M.size()));
+   THROWERROR_ASSERT(scale.size() == static_cast<std::size_t>(M.cols()) && offset.size() == scale.size());
+
+   #pragma omp parallel for schedule(static)
+   for (Eigen::Index i = 0; i < M.rows(); ++i)
+      for (Eigen::Index j = 0; j < M.cols(); ++j)
+         M(i, j) = offset[j] + scale[j] * data[i * M.cols() + j];
+}
+
+}}
@@ -1,5 +1,9 @@
 #include <iostream>
 
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
 #include <SmurffCpp/Utils/SaveState.h>
 
 #include <SmurffCpp/Model.h>
@@ -8,6 +12,7 @@
 
 #include <SmurffCpp/Utils/Error.h>
 #include <SmurffCpp/Utils/StringUtils.h>
+#include <SmurffCpp/Utils/PackedSymmetric.hpp>
 
 
 #define LATENTS_SEC_TAG "latents"
@@ -51,6 +56,8 @@ SaveState::SaveState(h5::File file, std::int32_t isample, bool checkpoint, bool
    , m_isample(isample)
    , m_checkpoint(checkpoint)
    , m_save_aggr(save_aggr)
+   , m_sample_storage(SampleStorageTypes::full)
+   , m_sample_compression(0)
 {
    m_group.createAttribute<int>(IS_CHECKPOINT_TAG, m_checkpoint);
    m_group.createAttribute<int>(NUMBER_TAG, m_isample);
@@ -58,6 +65,8 @@ SaveState::SaveState(h5::File file, std::int32_t isample, bool checkpoint, bool
 
 SaveState::SaveState(h5::File file, h5::Group group)
    : HDF5Group(group), m_file(file)
+   , m_sample_storage(SampleStorageTypes::full)
+   , m_sample_compression(0)
 {
    group.getAttribute(NUMBER_TAG).read(m_isample);
    int m_checkpoint_as_int;
@@ -65,14 +74,32 @@ SaveState::SaveState(h5::File file, h5::Group group)
    m_checkpoint = m_checkpoint_as_int;
 }
 
+// flushes the HDF5 buffers and the OS cache, so everything written so far survives a crash
+static void sync(h5::File &file)
+{
+   file.flush();
+
+#ifndef _WIN32
+   void *handle = nullptr;
+   if (H5Fget_vfd_handle(file.getId(), H5P_DEFAULT, &handle) >= 0 && handle)
+      ::fsync(*static_cast<int *>(handle));
+#endif
+}
+
 SaveState::~SaveState()
 {
    if (isCheckpoint())
    {
+      // a checkpoint is referenced only once its data is durable,
+      // and the reference is durable before older checkpoints are removed
+      sync(m_file);
       m_file.getAttribute(LAST_CHECKPOINT_TAG).write(getName());
+      sync(m_file);
+   }
+   else
+   {
+      m_file.flush();
    }
-
-   m_file.flush();
 }
 
 //name methods
@@ -93,17 +120,31 @@ void SaveState::readModel(std::uint64_t index, Matrix &m) const
    read(LATENTS_SEC_TAG, LATENTS_PREFIX + std::to_string(index), m);
 }
 
+std::uint64_t SaveState::readModel(std::uint64_t index, const std::vector<int> &rows, Matrix &m) const
+{
+   return read(LATENTS_SEC_TAG, LATENTS_PREFIX + std::to_string(index), rows, m);
+}
+
 std::string SaveState::getName() const
 {
    return std::string(isCheckpoint() ? CHECKPOINT_PREFIX : SAMPLE_PREFIX) + std::to_string(getIsample());
 }
 
+void SaveState::setSampleStorage(SampleStorageTypes storage, int compression)
+{
+   m_sample_storage = storage;
+   m_sample_compression = compression;
+}
+
 void SaveState::putModel(const std::vector<Matrix> &F)
 {
+   // a checkpoint is restored to continue sampling, so it is kept exact
+   const SampleStorageTypes storage = m_checkpoint ? SampleStorageTypes::full : m_sample_storage;
+
    m_group.createAttribute(NUM_MODES_TAG, F.size());
    for (std::uint64_t m = 0; m < F.size(); ++m)
    {
-      write(LATENTS_SEC_TAG, LATENTS_PREFIX + std::to_string(m), F[m]);
+      write(LATENTS_SEC_TAG, LATENTS_PREFIX + std::to_string(m), F[m], storage, m_sample_compression);
    }
 }
 
@@ -129,30 +170,54 @@ void SaveState::putMu(std::uint64_t index, const Matrix &M)
 
 bool SaveState::hasAggr(std::uint64_t index) const
 {
-   return hasDataSet(LATENTS_SEC_TAG, POST_NUM_PREFIX + std::to_string(index));
+   // post_num_ is an attribute of the latents group, written together with the datasets
+   return hasDataSet(LATENTS_SEC_TAG, POST_SUM_PREFIX + std::to_string(index));
+}
+
+bool SaveState::hasPostMuLambda(std::uint64_t index) const
+{
+   return hasDataSet(LATENTS_SEC_TAG, POST_LAMBDA_PREFIX + std::to_string(index));
+}
+
+// older files store the full K x K matrix per row
+static void repack(AggrMatrix &M, int num_latent)
+{
+   if (M.cols() == packed::size(num_latent))
+      return;
+
+   THROWERROR_ASSERT_MSG(M.cols() == num_latent * num_latent,
+      "Unexpected number of columns in posterior aggregate: " + std::to_string(M.cols()));
+
+   AggrMatrix P(M.rows(), packed::size(num_latent));
+   for (int i = 0; i < M.rows(); ++i)
+      packed::pack(P.row(i), Eigen::Map<const AggrMatrix>(M.row(i).data(), num_latent, num_latent));
+
+   std::swap(M, P);
 }
 
-void SaveState::readAggr(std::uint64_t index, int &num, Matrix &sum, Matrix &dot) const
+void SaveState::readAggr(std::uint64_t index, int &num, Matrix &sum, AggrMatrix &dot) const
 {
    getGroup(LATENTS_SEC_TAG).getAttribute(POST_NUM_PREFIX + std::to_string(index)).read(num);
    read(LATENTS_SEC_TAG, POST_SUM_PREFIX + std::to_string(index), sum);
    read(LATENTS_SEC_TAG, POST_DOT_PREFIX + std::to_string(index), dot);
+   repack(dot, sum.cols());
 }
 
-void SaveState::putAggr(std::uint64_t index, int num, const Matrix &sum, const Matrix &dot)
+void SaveState::putAggr(std::uint64_t index, int num, const Matrix &sum, const AggrMatrix &dot)
 {
    addGroup(LATENTS_SEC_TAG).createAttribute(POST_NUM_PREFIX + std::to_string(index), num);
    write(LATENTS_SEC_TAG, POST_SUM_PREFIX + std::to_string(index), sum);
    write(LATENTS_SEC_TAG, POST_DOT_PREFIX + std::to_string(index), dot);
 }
 
-void SaveState::readPostMuLambda(std::uint64_t index, Matrix &mu, Matrix &Lambda) const
+void SaveState::readPostMuLambda(std::uint64_t index, Matrix &mu, AggrMatrix &Lambda) const
 {
    read(LATENTS_SEC_TAG, POST_MU_PREFIX + std::to_string(index), mu);
    read(LATENTS_SEC_TAG, POST_LAMBDA_PREFIX + std::to_string(index), Lambda);
+   repack(Lambda, mu.cols());
 }
 
-void SaveState::putPostMuLambda(std::uint64_t index, const Matrix &mu, const Matrix &Lambda)
+void SaveState::putPostMuLambda(std::uint64_t index, const Matrix &mu, const AggrMatrix &Lambda)
 {
    write(LATENTS_SEC_TAG, POST_MU_PREFIX + std::to_string(index), mu);
    write(LATENTS_SEC_TAG, POST_LAMBDA_PREFIX + std::to_string(index), Lambda);
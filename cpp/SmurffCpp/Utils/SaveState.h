@@ -24,6 +24,8 @@ namespace smurff {
       std::int32_t m_isample;
       bool m_checkpoint;
       bool m_save_aggr;
+      SampleStorageTypes m_sample_storage;
+      int m_sample_compression;
 
    public:
       //this constructor should be used to create a step file on a first run of trainSession
@@ -34,17 +36,25 @@ namespace smurff {
 
       ~SaveState();
 
+      // storage of the latent matrices written by putModel, lossy encodings only apply to samples
+      void setSampleStorage(SampleStorageTypes storage, int compression);
+
    public:
       bool hasModel(std::uint64_t index) const;
       bool hasAggr(std::uint64_t index) const;
+      bool hasPostMuLambda(std::uint64_t index) const;
       bool hasPred() const;
 
 
+      // samples saved as float16 or uint8 are decoded
       void readModel(std::uint64_t index, Matrix &) const;
+      // only the given rows (sorted, unique), in that order; returns the number of rows of the stored matrix
+      std::uint64_t readModel(std::uint64_t index, const std::vector<int> &rows, Matrix &) const;
       void readMu(std::uint64_t index, Vector &) const;
       void readLinkMatrix(std::uint32_t index, Matrix &) const;
-      void readAggr(std::uint64_t index, int &, Matrix &, Matrix &) const;
-      void readPostMuLambda(std::uint64_t index, Matrix &, Matrix &) const;
+      // second moments and precisions are packed lower triangles, see PackedSymmetric.hpp
+      void readAggr(std::uint64_t index, int &, Matrix &, AggrMatrix &) const;
+      void readPostMuLambda(std::uint64_t index, Matrix &, AggrMatrix &) const;
 
       void getPredState(double &rmse_avg, double &rmse_1sample, double &auc_avg, double &auc_1sample, int &sample_iter, int &burnin_iter) const;
 
@@ -53,8 +63,8 @@ namespace smurff {
       void readPredVar(Matrix &) const;
 
       void putModel(const std::vector<Matrix> &);
-      void putAggr(std::uint64_t index, const int, const Matrix &, const Matrix &);
-      void putPostMuLambda(std::uint64_t index, const Matrix &, const Matrix &);
+      void putAggr(std::uint64_t index, const int, const Matrix &, const AggrMatrix &);
+      void putPostMuLambda(std::uint64_t index, const Matrix &, const AggrMatrix &);
 
       void putMu(std::uint64_t index, const Matrix &);
       void putLinkMatrix(std::uint64_t mode, const Matrix &);
@@ -8,6 +8,7 @@
 #include <SmurffCpp/Utils/Error.h>
 #include <SmurffCpp/Utils/StringUtils.h>
 #include <SmurffCpp/StatusItem.h>
+#include <SmurffCpp/Predict/LatentIndex.h>
 
 namespace h5 = HighFive;
 
@@ -20,10 +21,27 @@ const std::string STATUS_TAG = "status";
 const std::string LAST_CHECKPOINT_TAG = "last_checkpoint";
 const std::string CHECKPOINT_PREFIX = "checkpoint_";
 const std::string SAMPLE_PREFIX = "sample_";
+const std::string INDEX_PREFIX = "index_";
+
+// align datasets to the size of their elements, so HDF5Group::map can use them in place
+struct DataAlignment
+{
+   void apply(hid_t hid) const
+   {
+      H5Pset_alignment(hid, 1, sizeof(double));
+   }
+};
+
+static h5::FileDriver stateFileAccess()
+{
+   h5::FileDriver fapl;
+   fapl.add(DataAlignment());
+   return fapl;
+}
 
 StateFile::StateFile(std::string path, bool create)
    : m_path(path)
-   , m_h5(path, create ? h5::File::Overwrite : h5::File::ReadWrite)
+   , m_h5(path, create ? h5::File::Overwrite : h5::File::ReadWrite, stateFileAccess())
 {
    if (create)
    {
@@ -75,6 +93,28 @@ void StateFile::removeOldCheckpoints()
    }
 }
 
+bool StateFile::hasIndex(int mode) const
+{
+   return m_h5.exist(INDEX_PREFIX + std::to_string(mode));
+}
+
+void StateFile::saveIndex(int mode, const LatentIndex &index)
+{
+   const std::string name = INDEX_PREFIX + std::to_string(mode);
+   if (m_h5.exist(name))
+      m_h5.unlink(name);
+
+   HDF5Group h5_index(m_h5.createGroup(name));
+   index.save(h5_index);
+   m_h5.flush();
+}
+
+void StateFile::restoreIndex(int mode, LatentIndex &index) const
+{
+   HDF5Group h5_index(m_h5.getGroup(INDEX_PREFIX + std::to_string(mode)));
+   index.restore(h5_index);
+}
+
 bool StateFile::hasCheckpoint() const
 {
    std::string lastCheckpointItem;
@@ -12,6 +12,7 @@ namespace h5 = HighFive;
 namespace smurff {
 
 struct StatusItem;
+class LatentIndex;
 
 extern const std::string LAST_CHECKPOINT_TAG;
 
@@ -38,6 +39,12 @@ public:
 public:
    void removeOldCheckpoints();
 
+public:
+   // approximate nearest-neighbour index over mode `mode`, stored with the samples
+   bool hasIndex(int mode) const;
+   void saveIndex(int mode, const LatentIndex &);
+   void restoreIndex(int mode, LatentIndex &) const;
+
 public:
    bool hasCheckpoint() const;
    SaveState openCheckpoint() const;
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace smurff {
+
+// The k best (score, id) candidates pushed so far, kept in a bounded heap.
+// Better means a higher score, then a lower id, so results do not depend on
+// the order candidates are pushed in.
+class TopK
+{
+public:
+   typedef std::pair<double, int> Candidate; // score, id
+
+private:
+   int m_k;
+   std::vector<Candidate> m_heap; // worst candidate in front
+
+   static bool better(const Candidate &a, const Candidate &b)
+   {
+      return a.first > b.first || (a.first == b.first && a.second < b.second);
+   }
+
+public:
+   explicit TopK(int k) : m_k(k)
+   {
+      m_heap.reserve(k);
+   }
+
+   void push(double score, int id)
+   {
+      const Candidate c(score, id);
+      if ((int)m_heap.size() < m_k)
+      {
+         m_heap.push_back(c);
+         std::push_heap(m_heap.begin(), m_heap.end(), better);
+      }
+      else if (m_k > 0 && better(c, m_heap.front()))
+      {
+         std::pop_heap(m_heap.begin(), m_heap.end(), better);
+         m_heap.back() = c;
+         std::push_heap(m_heap.begin(), m_heap.end(), better);
+      }
+   }
+
+   // the candidates, best first; call clear before pushing again
+   const std::vector<Candidate> &sorted()
+   {
+      std::sort_heap(m_heap.begin(), m_heap.end(), better);
+      return m_heap;
+   }
+
+   void clear()
+   {
+      m_heap.clear();
+   }
+};
+
+}
@@ -207,22 +207,48 @@ void Result::restore(const SaveState &sf)
 
 //model - holds samples (U matrices)
 void Result::update(const Model &model, bool burnin)
+{
+   updateInternal(model, burnin, [this](size_t k) -> const PVec<> & { return m_predictions[k].coords; });
+}
+
+void Result::update(const Model &model, bool burnin, const std::vector<PVec<>> &coords)
+{
+   THROWERROR_ASSERT(coords.size() == m_predictions.size());
+   updateInternal(model, burnin, [&coords](size_t k) -> const PVec<> & { return coords[k]; });
+}
+
+template<typename Coords>
+void Result::updateInternal(const Model &model, bool burnin, const Coords &coords)
 {
    if (m_predictions.empty())
       return;
 
    const size_t NNZ = m_predictions.size();
+   const size_t nbatches = (NNZ + Model::PREDICT_BATCH - 1) / Model::PREDICT_BATCH;
+
+   // predictions of the items in batch b, in pred
+   auto predict_batch = [&model, &coords, NNZ](size_t b, double *pred) -> size_t {
+      const size_t start = b * Model::PREDICT_BATCH;
+      const size_t n = std::min<size_t>(Model::PREDICT_BATCH, NNZ - start);
+      model.predict([&coords, start](size_t k) -> decltype(coords(0)) { return coords(start + k); }, n, pred);
+      return n;
+   };
 
    if (burnin)
    {
       double se_1sample = 0.0;
 
       #pragma omp parallel for schedule(guided) reduction(+:se_1sample)
-      for(size_t k = 0; k < m_predictions.size(); ++k)
+      for(size_t b = 0; b < nbatches; ++b)
       {
-         auto &t = m_predictions.operator[](k);
-         t.pred_1sample = model.predict(t.coords); //dot product of i'th columns in each U matrix
-         se_1sample += std::pow(t.val - t.pred_1sample, 2);
+         double pred[Model::PREDICT_BATCH];
+         const size_t n = predict_batch(b, pred);
+         for(size_t j = 0; j < n; ++j)
+         {
+            auto &t = m_predictions[b * Model::PREDICT_BATCH + j];
+            t.pred_1sample = pred[j];
+            se_1sample += std::pow(t.val - t.pred_1sample, 2);
+         }
       }
 
       burnin_iter++;
@@ -240,14 +266,18 @@ void Result::update(const Model &model, bool burnin)
       double se_avg = 0.0;
 
       #pragma omp parallel for schedule(guided) reduction(+:se_1sample, se_avg)
-      for(size_t k = 0; k < m_predictions.size(); ++k)
+      for(size_t b = 0; b < nbatches; ++b)
       {
-         auto &t = m_predictions.operator[](k);
-         const double pred = model.predict(t.coords); //dot product of i'th columns in each U matrix
-         t.update(pred);
-
-         se_1sample += std::pow(t.val - pred, 2);
-         se_avg += std::pow(t.val - t.pred_avg, 2);
+         double pred[Model::PREDICT_BATCH];
+         const size_t n = predict_batch(b, pred);
+         for(size_t j = 0; j < n; ++j)
+         {
+            auto &t = m_predictions[b * Model::PREDICT_BATCH + j];
+            t.update(pred[j]);
+
+            se_1sample += std::pow(t.val - pred[j], 2);
+            se_avg += std::pow(t.val - t.pred_avg, 2);
+         }
       }
 
       sample_iter++;
@@ -265,6 +295,42 @@ void Result::update(const Model &model, bool burnin)
    }
 }
 
+void Result::updateSummary(const Model &model)
+{
+   THROWERROR_ASSERT_MSG(model.hasAggr(), "Summary predictions need the posterior aggregates of all modes");
+
+   if (m_predictions.empty())
+      return;
+
+   const size_t NNZ = m_predictions.size();
+   const int nsamples = model.getNumAggr(0);
+   double se_avg = 0.0;
+
+   #pragma omp parallel for schedule(guided) reduction(+:se_avg)
+   for(size_t k = 0; k < NNZ; ++k)
+   {
+      auto &t = m_predictions[k];
+      double mean, var;
+      model.predictSummary(t.coords, mean, var);
+
+      t.pred_1sample = NAN;
+      t.pred_avg = mean;
+      t.var = var * nsamples;
+      t.nsamples = nsamples;
+      se_avg += std::pow(t.val - mean, 2);
+   }
+
+   sample_iter = nsamples;
+   rmse_1sample = NAN;
+   rmse_avg = std::sqrt(se_avg / NNZ);
+
+   if (classify)
+   {
+      auc_avg = calc_auc(m_predictions, threshold,
+            [](const ResultItem &a, const ResultItem &b) { return a.pred_avg < b.pred_avg;});
+   }
+}
+
 std::ostream &Result::info(std::ostream &os, std::string indent) const
 {
    if (!m_predictions.empty())
@@ -80,6 +80,19 @@ public:
    //-- prediction metrics
    void update(const Model &model, bool burnin);
 
+   // as above, predicting item k at coords[k] of model, e.g. of a model restored
+   // with only the rows that the items use (see Model::restore)
+   void update(const Model &model, bool burnin, const std::vector<PVec<>> &coords);
+
+   // predictions from the aggregates of model (Model::predictSummary) in place of the
+   // average over samples: pred_avg is the mean, var the sum of squared deviations as
+   // update accumulates it (number of aggregated samples times the variance)
+   void updateSummary(const Model &model);
+
+private:
+   template<typename Coords>
+   void updateInternal(const Model &model, bool burnin, const Coords &coords);
+
 public:
    double rmse_avg = NAN;
    double rmse_1sample = NAN;
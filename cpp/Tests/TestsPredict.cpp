@@ -1,17 +1,21 @@
 #ifdef HAVE_BOOST
 
+#include <cmath>
 #include <cstdio>
 #include <fstream>
 
 #include <boost/filesystem/operations.hpp>
 
+#include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <SmurffCpp/Types.h>
 
 #include <SmurffCpp/Configs/Config.h>
+#include <SmurffCpp/DataMatrices/Data.h>
 #include <SmurffCpp/Sessions/TrainSession.h>
 #include <SmurffCpp/Predict/PredictSession.h>
+#include <SmurffCpp/Utils/Distribution.h>
 #include <SmurffCpp/Utils/MatrixUtils.h>
 #include <SmurffCpp/Utils/StateFile.h>
 #include <SmurffCpp/result.h>
@@ -101,6 +105,141 @@ TEST_CASE("PredictSession/BPMF")
 }
 
 
+TEST_CASE("StateFile/mmap_data")
+{
+  Config config = genConfig(trainSparseMatrix, testSparseMatrix, {PriorTypes::normal, PriorTypes::normal});
+  config.setMmapData(true); // scarce train data saved with its transposed index
+  prepareResultDir(config, Catch::getResultCapture().getCurrentTestName());
+  StateFile(config.getSaveName(), true).saveConfig(config);
+
+  Config restored;
+  StateFile(config.getSaveName()).restoreConfig(restored);
+  REQUIRE(restored.getTrain().isMapped());
+  REQUIRE(restored.getTrain().getNNZ() == config.getTrain().getNNZ());
+
+  std::shared_ptr<Data> in_memory = Data::create(config);
+  std::shared_ptr<Data> mapped = Data::create(restored);
+  in_memory->init();
+  mapped->init();
+
+  init_bmrng(1234);
+  Model model;
+  model.init(4, config.getTrain().getDims(), ModelInitTypes::random, false);
+
+  for (std::uint32_t mode = 0; mode < 2; ++mode)
+  {
+    for (int n = 0; n < (int)model.U(mode).rows(); ++n)
+    {
+      Vector rr_memory = Vector::Zero(4), rr_mapped = Vector::Zero(4);
+      Matrix MM_memory = Matrix::Zero(4, 4), MM_mapped = Matrix::Zero(4, 4);
+      in_memory->getMuLambda(model, mode, n, rr_memory, MM_memory);
+      mapped->getMuLambda(model, mode, n, rr_mapped, MM_mapped);
+      REQUIRE(rr_mapped.isApprox(rr_memory));
+      REQUIRE(MM_mapped.isApprox(MM_memory));
+    }
+  }
+}
+
+TEST_CASE("SaveState/readModel/rows")
+{
+  fs::create_directory("tests_output");
+  const std::string fname = "tests_output/SaveState_readModel_rows.h5";
+
+  init_bmrng(1234);
+  const Matrix U = Matrix::NullaryExpr(3000, 5, RandNormalGenerator());
+  const Matrix V = Matrix::NullaryExpr(40, 5, RandNormalGenerator());
+
+  // full precision and float16, both chunked and compressed; rows span several chunks
+  for (auto storage : {SampleStorageTypes::full, SampleStorageTypes::float16})
+  {
+    {
+      StateFile file(fname, true);
+      SaveState step = file.createSampleStep(1, false);
+      step.setSampleStorage(storage, 6);
+      step.putModel({U, V});
+    }
+
+    StateFile file(fname);
+    std::vector<SaveState> steps = file.openSampleSteps();
+    REQUIRE(steps.size() == 1);
+
+    Matrix all;
+    steps[0].readModel(0, all);
+    REQUIRE(all.rows() == U.rows());
+
+    const std::vector<int> rows = {0, 1, 2, 17, 1000, 1001, 2999};
+    Matrix part;
+    REQUIRE(steps[0].readModel(0, rows, part) == (std::uint64_t)U.rows());
+    REQUIRE(part.rows() == (Eigen::Index)rows.size());
+    for (std::size_t i = 0; i < rows.size(); ++i)
+      REQUIRE(part.row(i) == all.row(rows[i]));
+  }
+}
+
+TEST_CASE("PredictSession/summary")
+{
+  Config config = genConfig(trainDenseMatrix, testSparseMatrix, {PriorTypes::normal, PriorTypes::normal});
+  prepareResultDir(config, Catch::getResultCapture().getCurrentTestName() + "_train");
+  config.setCheckpointFreq(1); // a checkpoint, with the posterior aggregates, is also saved after the last iteration
+  std::string model_file = config.getSaveName();
+
+  TrainSession(config).run();
+
+  // as smurff --restore-from model_file --predict-mode summary
+  Config predict_config = config;
+  prepareResultDir(predict_config, Catch::getResultCapture().getCurrentTestName() + "_predict");
+  predict_config.setRestoreName(model_file);
+  predict_config.setPredictMode(PredictModes::summary);
+  predict_config.setSaveFreq(0);
+
+  PredictSession summary_session(predict_config);
+  summary_session.run();
+  const Result &summary = summary_session.getResult();
+
+  // the checkpoint aggregates cover the same samples as the saved sample steps
+  std::vector<SaveState> steps = StateFile(model_file).openSampleSteps();
+  std::vector<Matrix> mean(2);
+  for (const auto &step : steps)
+  {
+    Model model;
+    model.restore(step);
+    for (int m = 0; m < 2; ++m)
+    {
+      if (mean[m].size() == 0)
+        mean[m] = Matrix::Zero(model.U(m).rows(), model.U(m).cols());
+      mean[m] += model.U(m) / steps.size();
+    }
+  }
+
+  // with the modes independent, the predictive mean is the product of the posterior means
+  const std::vector<ResultItem> &items = summary.m_predictions;
+  REQUIRE(items.size() == (std::size_t)config.getTest().getNNZ());
+  for (const auto &item : items)
+  {
+    REQUIRE(item.nsamples == (int)steps.size());
+    REQUIRE(item.pred_avg == Catch::Approx(mean[0].row(item.coords[0]).dot(mean[1].row(item.coords[1]))).epsilon(1e-6));
+    REQUIRE(item.var >= 0.0);
+  }
+
+  // compared against the average over all samples
+  const SummaryError &err = summary_session.getSummaryError();
+  REQUIRE(err.items == items.size());
+  REQUIRE(std::isfinite(err.mean_rmse));
+  REQUIRE(std::isfinite(err.std_rmse));
+}
+
+TEST_CASE("PredictSession/summary/nocheckpoint")
+{
+  Config config = genConfig(trainDenseMatrix, testSparseMatrix, {PriorTypes::normal, PriorTypes::normal});
+  prepareResultDir(config, Catch::getResultCapture().getCurrentTestName() + "_train");
+  std::string model_file = config.getSaveName();
+
+  TrainSession(config).run();
+
+  PredictSession s(model_file);
+  REQUIRE_THROWS(s.predictSummary(config.getTest()));
+}
+
 TEST_CASE("TrainSession/TensorBPMF")
 {
   Config config = genConfig(trainSparseTensor3d, testSparseTensor3d, {PriorTypes::normal, PriorTypes::normal, PriorTypes::normal});
@@ -455,5 +455,38 @@ TEST_CASE("train_sparse_3d_tensor_test_sparse_3d_tensor_macauone_normal_row_dens
       .addSideInfo(0, rowSideDenseMatrix3d)
       .runAndCheck(3280);
 }
+//=================================================================
+
+TEST_CASE("train_sparse_matrix_test_sparse_matrix_normal_normal_none_none_residual_cache",
+          TAG_MATRIX_TESTS) {
+  Config config = genConfig(trainSparseMatrix, testSparseMatrix, {PriorTypes::normal, PriorTypes::normal});
+  config.getTrain().setNoiseConfig(NoiseConfig(NoiseTypes::adaptive));
+  Config cachedConfig = config;
+  cachedConfig.setResidualCache(true);
+
+  std::shared_ptr<ISession> session = std::make_shared<TrainSession>(config);
+  std::shared_ptr<ISession> cachedSession = std::make_shared<TrainSession>(cachedConfig);
+  session->run();
+  cachedSession->run();
+
+  checkValue(cachedSession->getRmseAvg(), session->getRmseAvg(), rmse_epsilon);
+  checkResultItems(cachedSession->getResultItems(), session->getResultItems());
+}
+
+TEST_CASE("train_sparse_matrix_test_sparse_matrix_normal_normal_none_none_deferred_stats",
+          TAG_MATRIX_TESTS) {
+  Config config = genConfig(trainSparseMatrix, testSparseMatrix, {PriorTypes::normal, PriorTypes::normal});
+  Config deferredConfig = config;
+  deferredConfig.setDeferredStats(true);
+
+  std::shared_ptr<ISession> session = std::make_shared<TrainSession>(config);
+  std::shared_ptr<ISession> deferredSession = std::make_shared<TrainSession>(deferredConfig);
+  session->run();
+  deferredSession->run();
+
+  checkValue(deferredSession->getRmseAvg(), session->getRmseAvg(), rmse_epsilon);
+  checkResultItems(deferredSession->getResultItems(), session->getResultItems());
+}
+
 } // namespace test
 } // namespace smurff
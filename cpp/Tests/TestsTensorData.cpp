@@ -56,10 +56,10 @@ TEST_CASE("test sparse view new 1")
          {
             for (std::uint64_t m = 0; m < sview->getNCoords(); m++) //go through each coordinate of a value
             {
-               std::cout << sview->getIndices()(j, m) << ", "; //print coordinate
+               std::cout << sview->coord(j, m) << ", "; //print coordinate
             }
 
-            std::cout << sview->getValues()[j] << std::endl; //print value
+            std::cout << sview->value(j) << std::endl; //print value
          }
       }
 
@@ -121,6 +121,53 @@ TEST_CASE("test sparse view new 2")
    */
 }
 
+TEST_CASE("test sparse view shared storage")
+{
+   std::vector<std::uint64_t> tensorConfigDims = { 3, 2, 4, 2 };
+   std::vector<std::vector<std::uint32_t>> tensorConfigColumns =
+      {
+         { 2, 0, 1, 0, 2, 1, 0 },
+         { 1, 0, 1, 1, 0, 0, 1 },
+         { 3, 0, 2, 1, 0, 3, 2 },
+         { 0, 1, 1, 0, 1, 0, 0 },
+      };
+   std::vector<double> tensorConfigValues = { 1, 2, 3, 4, 5, 6, 7 };
+   SparseTensor tensorConfig(tensorConfigDims, tensorConfigColumns, tensorConfigValues);
+
+   TensorData td(tensorConfig);
+
+   for(uint64_t mode = 0; mode < td.nmode(); mode++)
+   {
+      std::shared_ptr<SparseMode> sview = td.Y(mode);
+      REQUIRE(sview->getNNZ() == tensorConfigValues.size());
+      REQUIRE(sview->getNCoords() == 3);
+      REQUIRE(sview->sharedBytes() == td.Y(0)->sharedBytes());
+
+      std::uint64_t nitems = 0;
+      for(std::uint64_t h = 0; h < sview->getNPlanes(); h++)
+      {
+         std::vector<int> prev; // items are in fiber order within a hyperplane
+         for(std::uint64_t n = 0; n < sview->nItemsOnPlane(h); n++, nitems++)
+         {
+            auto item = sview->item(h, n);
+            std::uint64_t i = static_cast<std::uint64_t>(item.second) - 1;
+            REQUIRE(item.first[mode] == (int)h);
+            for(uint64_t m = 0; m < td.nmode(); m++)
+               REQUIRE(item.first[m] == (int)tensorConfigColumns[m][i]);
+            std::vector<int> rest;
+            for(uint64_t m = 0; m < td.nmode(); m++)
+               if (m != mode) rest.push_back(item.first[m]);
+            REQUIRE(prev <= rest);
+            prev = rest;
+         }
+      }
+      REQUIRE(nitems == tensorConfigValues.size());
+   }
+
+   // only the first mode is stored in its own order
+   REQUIRE(td.Y(0)->ownBytes() < td.Y(1)->ownBytes());
+}
+
 //smurff
 
 /*
@@ -13,16 +13,16 @@
   }
 },
 { 411,
-  { 0.1787947308976588,
+  { 0.1394256504904360,
       {
-         { { 0,0 }, 1.0000000000000000, 1.0642539474909127, 1.3467740826090897, 11.0656573530205939,  },
-         { { 0,1 }, 2.0000000000000000, 2.2482375946947561, 2.1677589388796266, 6.7558046011131436,  },
-         { { 0,2 }, 3.0000000000000000, 3.6683403415677129, 2.9312655795168054, 12.6105046101860783,  },
-         { { 0,3 }, 4.0000000000000000, 3.9207186058391619, 3.7036008634961903, 11.1497943347267832,  },
-         { { 2,0 }, 9.0000000000000000, 8.9521632468810868, 8.9651582035190653, 8.7098681805948814,  },
-         { { 2,1 }, 10.0000000000000000, 9.9192796543679940, 9.9461675683344026, 13.9449225844900031,  },
-         { { 2,2 }, 11.0000000000000000, 10.9867193944573600, 11.0536893020927405, 13.9427569305334931,  },
-         { { 2,3 }, 12.0000000000000000, 10.8869708675840986, 12.0881693206910175, 11.6086992908827931,  },
+         { { 0,0 }, 1.0000000000000000, 1.3581644904457510, 1.2804647079192251, 6.7312632988816441,  },
+         { { 0,1 }, 2.0000000000000000, 2.8916199988887499, 2.0941236171446014, 7.4654438624844408,  },
+         { { 0,2 }, 3.0000000000000000, 3.0085724349910778, 2.9203566877989298, 10.3758048431059695,  },
+         { { 0,3 }, 4.0000000000000000, 4.3358938377466876, 3.7958738187033161, 8.9558958409801726,  },
+         { { 2,0 }, 9.0000000000000000, 9.3255443993494147, 8.8687578858925491, 10.4634590849784015,  },
+         { { 2,1 }, 10.0000000000000000, 9.9758282065663355, 9.9918129134295199, 7.9352334433782259,  },
+         { { 2,2 }, 11.0000000000000000, 11.1625690191457547, 10.9619076814389462, 9.2204763204961289,  },
+         { { 2,3 }, 12.0000000000000000, 11.9356522807711105, 12.0352602853145534, 8.8902480743260028,  },
       }
   }
 },
@@ -181,16 +181,16 @@
   }
 },
 { 1075,
-  { 0.1840908684182263,
+  { 0.1465230882023034,
       {
-         { { 0,0 }, 1.0000000000000000, 1.5941595927147967, 1.3193567624940561, 9.3508428155804673,  },
-         { { 0,1 }, 2.0000000000000000, 1.9240459366152587, 2.1091952069078173, 9.0803097782459918,  },
-         { { 0,2 }, 3.0000000000000000, 3.1631091579399295, 2.8992041249536236, 8.7298581091299337,  },
-         { { 0,3 }, 4.0000000000000000, 3.8468148454085593, 3.6556785738360236, 5.6558062750058964,  },
-         { { 2,0 }, 9.0000000000000000, 8.4738136099712484, 8.8986938069435446, 6.7687273295138812,  },
-         { { 2,1 }, 10.0000000000000000, 10.2437850381417022, 9.9061251832866954, 12.9569681146239031,  },
-         { { 2,2 }, 11.0000000000000000, 11.4451007209631541, 10.9071315461902394, 7.0565977395662189,  },
-         { { 2,3 }, 12.0000000000000000, 11.6823068133356980, 12.0280395987482756, 9.2971391977015827,  },
+         { { 0,0 }, 1.0000000000000000, 1.4427272635570558, 1.2696670314042324, 6.4348432223737788,  },
+         { { 0,1 }, 2.0000000000000000, 2.2763151934896388, 2.1261822837483866, 5.6666542887237554,  },
+         { { 0,2 }, 3.0000000000000000, 3.0099590315217624, 2.9777100556436431, 9.1310835035686839,  },
+         { { 0,3 }, 4.0000000000000000, 3.9023739302654086, 3.8324315843144481, 4.8711805393338716,  },
+         { { 2,0 }, 9.0000000000000000, 9.4767129313126777, 8.7872287297721421, 12.3169990134021070,  },
+         { { 2,1 }, 10.0000000000000000, 10.2064083753902732, 10.0002282174387709, 8.9372004734960395,  },
+         { { 2,2 }, 11.0000000000000000, 10.6449219913029847, 10.9508827105484876, 7.0937202280263989,  },
+         { { 2,3 }, 12.0000000000000000, 11.8934734595562670, 12.0827626561739994, 13.7741494857883584,  },
       }
   }
 },
@@ -349,16 +349,16 @@
   }
 },
 { 1844,
-  { 0.1787947308976588,
+  { 0.1394256504904360,
       {
-         { { 0,0 }, 1.0000000000000000, 1.0642539474909127, 1.3467740826090897, 11.0656573530205939,  },
-         { { 0,1 }, 2.0000000000000000, 2.2482375946947561, 2.1677589388796266, 6.7558046011131436,  },
-         { { 0,2 }, 3.0000000000000000, 3.6683403415677129, 2.9312655795168054, 12.6105046101860783,  },
-         { { 0,3 }, 4.0000000000000000, 3.9207186058391619, 3.7036008634961903, 11.1497943347267832,  },
-         { { 2,0 }, 9.0000000000000000, 8.9521632468810868, 8.9651582035190653, 8.7098681805948814,  },
-         { { 2,1 }, 10.0000000000000000, 9.9192796543679940, 9.9461675683344026, 13.9449225844900031,  },
-         { { 2,2 }, 11.0000000000000000, 10.9867193944573600, 11.0536893020927405, 13.9427569305334931,  },
-         { { 2,3 }, 12.0000000000000000, 10.8869708675840986, 12.0881693206910175, 11.6086992908827931,  },
+         { { 0,0 }, 1.0000000000000000, 1.3581644904457510, 1.2804647079192251, 6.7312632988816441,  },
+         { { 0,1 }, 2.0000000000000000, 2.8916199988887499, 2.0941236171446014, 7.4654438624844408,  },
+         { { 0,2 }, 3.0000000000000000, 3.0085724349910778, 2.9203566877989298, 10.3758048431059695,  },
+         { { 0,3 }, 4.0000000000000000, 4.3358938377466876, 3.7958738187033161, 8.9558958409801726,  },
+         { { 2,0 }, 9.0000000000000000, 9.3255443993494147, 8.8687578858925491, 10.4634590849784015,  },
+         { { 2,1 }, 10.0000000000000000, 9.9758282065663355, 9.9918129134295199, 7.9352334433782259,  },
+         { { 2,2 }, 11.0000000000000000, 11.1625690191457547, 10.9619076814389462, 9.2204763204961289,  },
+         { { 2,3 }, 12.0000000000000000, 11.9356522807711105, 12.0352602853145534, 8.8902480743260028,  },
       }
   }
 },
@@ -475,16 +475,16 @@
   }
 },
 { 3110,
-  { 0.1434052286351355,
+  { 0.1394234781651019,
       {
-         { { 0,0,0 }, 1.0000000000000000, 0.5371694605293350, 1.2149451666648865, 11.2141968713622884,  },
-         { { 0,0,1 }, 2.0000000000000000, 2.9971834519629414, 2.1015020617549651, 6.2760592892182006,  },
-         { { 0,0,2 }, 3.0000000000000000, 3.1116874654063293, 2.7773983379699740, 5.5454516573026256,  },
-         { { 0,0,3 }, 4.0000000000000000, 3.2994249994997835, 3.7870672995505266, 13.2437332959181226,  },
-         { { 0,2,0 }, 9.0000000000000000, 8.1741543518603095, 8.9520217549180465, 9.3511175528241957,  },
-         { { 0,2,1 }, 10.0000000000000000, 10.1823592786763726, 10.0359950848237016, 16.5648438366770776,  },
-         { { 0,2,2 }, 11.0000000000000000, 12.1798776921212841, 11.0714534754453968, 10.9134660348485468,  },
-         { { 0,2,3 }, 12.0000000000000000, 11.3331284631102776, 12.0664935443557404, 9.4484282710721903,  },
+         { { 0,0,0 }, 1.0000000000000000, 0.9861463616375501, 1.1927918312817105, 9.6234913411039091,  },
+         { { 0,0,1 }, 2.0000000000000000, 1.4974882042610898, 2.0566639333125498, 10.5856253116535299,  },
+         { { 0,0,2 }, 3.0000000000000000, 2.5189264624496270, 2.8991119182473426, 11.5349534426939364,  },
+         { { 0,0,3 }, 4.0000000000000000, 3.9023886133147161, 3.6850309991838488, 7.5764434852242424,  },
+         { { 0,2,0 }, 9.0000000000000000, 9.3099338643088565, 8.9599186097605390, 12.6632117182748551,  },
+         { { 0,2,1 }, 10.0000000000000000, 10.0385605296033855, 9.9512492568350073, 7.7617856792120481,  },
+         { { 0,2,2 }, 11.0000000000000000, 10.5100238107452526, 10.9651813907000442, 8.7454797590340032,  },
+         { { 0,2,3 }, 12.0000000000000000, 12.6227641661323844, 11.9764969429493302, 10.9112710208947910,  },
       }
   }
 },
@@ -503,30 +503,30 @@
   }
 },
 { 3222,
-  { 0.1414254945143375,
+  { 0.1613196174106359,
       {
-         { { 0,0,0 }, 1.0000000000000000, 1.3093827870602590, 1.2478602100420726, 8.3167820952841023,  },
-         { { 0,0,1 }, 2.0000000000000000, 2.2872369563915380, 2.0824627967816252, 8.4119172696050466,  },
-         { { 0,0,2 }, 3.0000000000000000, 3.2814365109207975, 2.9677012978215505, 5.5694742698868547,  },
-         { { 0,0,3 }, 4.0000000000000000, 4.1233907559498171, 3.7786068657620286, 8.2311729430106393,  },
-         { { 0,2,0 }, 9.0000000000000000, 8.2232087464762742, 8.8080071071347739, 7.2330219513825194,  },
-         { { 0,2,1 }, 10.0000000000000000, 9.7364241341325073, 9.9940281417655328, 9.5735738586370154,  },
-         { { 0,2,2 }, 11.0000000000000000, 11.3063572682032252, 10.9341939144355340, 8.1054677261026367,  },
-         { { 0,2,3 }, 12.0000000000000000, 12.0940565639698470, 11.9778851528407255, 8.1734242122938792,  },
+         { { 0,0,0 }, 1.0000000000000000, 0.1094584401229947, 1.2688724368545530, 10.0348345183372647,  },
+         { { 0,0,1 }, 2.0000000000000000, 2.0818313869898812, 2.0161407625420100, 8.1856434340559936,  },
+         { { 0,0,2 }, 3.0000000000000000, 3.1155197808714394, 2.9371331051870087, 11.6759961070054015,  },
+         { { 0,0,3 }, 4.0000000000000000, 3.0931082549883255, 3.7465103335751757, 10.3370963104678921,  },
+         { { 0,2,0 }, 9.0000000000000000, 8.7704671471750366, 8.8730830457076326, 9.8370406637492511,  },
+         { { 0,2,1 }, 10.0000000000000000, 9.7142458823888607, 9.8865647070384579, 6.5502147099510317,  },
+         { { 0,2,2 }, 11.0000000000000000, 10.5668534270458174, 11.0783861191380044, 11.1896344765382096,  },
+         { { 0,2,3 }, 12.0000000000000000, 11.8935863232854224, 12.1797501601649714, 10.0013722237464311,  },
       }
   }
 },
 { 3280,
-  { 0.1100508356017407,
-      {
-         { { 0,0,0 }, 1.0000000000000000, 1.3418072439708082, 1.1979342555247006, 11.4222188979586949,  },
-         { { 0,0,1 }, 2.0000000000000000, 2.7409708366163676, 2.0268207295038052, 10.4887613254852550,  },
-         { { 0,0,2 }, 3.0000000000000000, 3.2296594900730513, 3.0185812621404611, 9.5492681190362863,  },
-         { { 0,0,3 }, 4.0000000000000000, 3.2866457826039550, 3.8212326607428166, 11.8649455489628988,  },
-         { { 0,2,0 }, 9.0000000000000000, 9.5515876307147138, 8.9684449747670172, 8.0969816112493742,  },
-         { { 0,2,1 }, 10.0000000000000000, 9.8055786951412998, 9.9316163439527632, 7.7517263195951660,  },
-         { { 0,2,2 }, 11.0000000000000000, 11.3159719396418570, 10.9204753993029922, 8.7418812779446302,  },
-         { { 0,2,3 }, 12.0000000000000000, 11.7115869751236730, 12.1126629453556589, 14.2107635846667240,  },
+  { 0.1502133776394889,
+      {
+         { { 0,0,0 }, 1.0000000000000000, 1.3371288926891478, 1.2698816510509472, 11.0266678340292561,  },
+         { { 0,0,1 }, 2.0000000000000000, 1.8801463514017309, 2.1666493729079725, 7.7251039324372579,  },
+         { { 0,0,2 }, 3.0000000000000000, 2.3027454531818550, 2.9029459249604983, 8.5744605327395487,  },
+         { { 0,0,3 }, 4.0000000000000000, 3.1892003007559691, 3.7801831985196150, 10.1451916619350424,  },
+         { { 0,2,0 }, 9.0000000000000000, 9.7568784316277242, 8.8706183915690744, 14.3007586279740551,  },
+         { { 0,2,1 }, 10.0000000000000000, 10.1005417686903218, 9.9808315312068370, 6.8434726462391708,  },
+         { { 0,2,2 }, 11.0000000000000000, 11.3304146944869650, 11.0696028376996871, 11.3450743261466798,  },
+         { { 0,2,3 }, 12.0000000000000000, 11.8440007762255028, 12.0146234744013505, 10.4827109888441328,  },
       }
   }
 },
@@ -1,434 +1,434 @@
 { 359,
-  { 0.1856653553239175,
+  { 0.1856592215362239,
       {
-         { { 0,0 }, 1.0000000000000000, 0.9640358686447144, 1.3686007297039031, 11.7950011944158959,  },
-         { { 0,1 }, 2.0000000000000000, 2.3190615177154541, 2.1561056089401238, 8.7892441456414954,  },
-         { { 0,2 }, 3.0000000000000000, 3.4321765899658203, 2.9806749677658080, 10.2711528278479616,  },
-         { { 0,3 }, 4.0000000000000000, 3.8587479591369629, 3.8058335590362553, 8.2500672394694288,  },
-         { { 2,0 }, 9.0000000000000000, 8.7321472167968750, 8.7619374179840079, 7.1830786697783342,  },
-         { { 2,1 }, 10.0000000000000000, 9.5409660339355469, 9.9090647888183589, 13.4261945635503110,  },
-         { { 2,2 }, 11.0000000000000000, 10.9539165496826172, 10.9985037994384776, 11.4962032674896193,  },
-         { { 2,3 }, 12.0000000000000000, 11.0096073150634766, 12.1118848800659169, 8.5206519107341592,  },
+         { { 0,0 }, 1.0000000000000000, 0.9638895988464355, 1.3685979342460630, 11.7947269729426427,  },
+         { { 0,1 }, 2.0000000000000000, 2.3190732002258301, 2.1561228108406074, 8.7892488974783998,  },
+         { { 0,2 }, 3.0000000000000000, 3.4322111606597900, 2.9807016897201546, 10.2710401564833678,  },
+         { { 0,3 }, 4.0000000000000000, 3.8589015007019043, 3.8058597755432140, 8.2494819403410329,  },
+         { { 2,0 }, 9.0000000000000000, 8.7321624755859375, 8.7619532489776617, 7.1830834975031852,  },
+         { { 2,1 }, 10.0000000000000000, 9.5409622192382812, 9.9090678596496566, 13.4258064757155893,  },
+         { { 2,2 }, 11.0000000000000000, 10.9539966583251953, 10.9984965705871591, 11.4958283327218034,  },
+         { { 2,3 }, 12.0000000000000000, 11.0096435546875000, 12.1118748474121087, 8.5209087870699367,  },
       }
   }
 },
 { 411,
-  { 0.1787994101699170,
+  { 0.1394625895329209,
       {
-         { { 0,0 }, 1.0000000000000000, 1.0642299652099609, 1.3467797076702122, 11.0659028299151760,  },
-         { { 0,1 }, 2.0000000000000000, 2.2482533454895020, 2.1677615833282466, 6.7559096555692797,  },
-         { { 0,2 }, 3.0000000000000000, 3.6683843135833740, 2.9312564373016361, 12.6104241629931284,  },
-         { { 0,3 }, 4.0000000000000000, 3.9208159446716309, 3.7035903120040894, 11.1496196870703752,  },
-         { { 2,0 }, 9.0000000000000000, 8.9521560668945312, 8.9651529884338412, 8.7099143633145992,  },
-         { { 2,1 }, 10.0000000000000000, 9.9192848205566406, 9.9461681938171385, 13.9449402932547137,  },
-         { { 2,2 }, 11.0000000000000000, 10.9867181777954102, 11.0536911964416458, 13.9427810437087079,  },
-         { { 2,3 }, 12.0000000000000000, 10.8869609832763672, 12.0881726455688501, 11.6087958974040557,  },
+         { { 0,0 }, 1.0000000000000000, 1.3617584705352783, 1.2805058729648586, 6.7323742762219112,  },
+         { { 0,1 }, 2.0000000000000000, 2.8930733203887939, 2.0941073584556578, 7.4619815407360122,  },
+         { { 0,2 }, 3.0000000000000000, 3.0058162212371826, 2.9203848838806152, 10.3807714859485731,  },
+         { { 0,3 }, 4.0000000000000000, 4.3372359275817871, 3.7957164955139162, 8.9465861800528739,  },
+         { { 2,0 }, 9.0000000000000000, 9.3251876831054688, 8.8687831687927243, 10.4702154664222462,  },
+         { { 2,1 }, 10.0000000000000000, 9.9759864807128906, 9.9917945861816424, 7.9350003541712795,  },
+         { { 2,2 }, 11.0000000000000000, 11.1633358001708984, 10.9618449592590359, 9.2173809403451958,  },
+         { { 2,3 }, 12.0000000000000000, 11.9359016418457031, 12.0353194236755368, 8.8881579411813565,  },
       }
   }
 },
 { 467,
-  { 0.0970675991742722,
+  { 0.0970691935018318,
       {
-         { { 0,0 }, 1.0000000000000000, 1.2220685482025146, 1.1711037170886991, 6.0960606126706613,  },
-         { { 0,1 }, 2.0000000000000000, 1.3740725517272949, 2.0652896428108209, 9.0072259357216993,  },
-         { { 0,2 }, 3.0000000000000000, 2.9769902229309082, 2.9510881376266478, 6.0911521226500263,  },
-         { { 0,3 }, 4.0000000000000000, 3.9142451286315918, 3.8679782724380498, 9.9024621015837297,  },
-         { { 2,0 }, 9.0000000000000000, 8.5226669311523438, 8.8801964187622051, 7.1671159013828563,  },
-         { { 2,1 }, 10.0000000000000000, 9.3107128143310547, 9.9872397613525408, 9.0471495929193058,  },
-         { { 2,2 }, 11.0000000000000000, 10.4210519790649414, 10.9882929611206048, 11.0500483112264991,  },
-         { { 2,3 }, 12.0000000000000000, 12.3408727645874023, 12.0858070373535114, 8.7724428115798201,  },
+         { { 0,0 }, 1.0000000000000000, 1.2220854759216309, 1.1711023330688479, 6.0963800960370724,  },
+         { { 0,1 }, 2.0000000000000000, 1.3740705251693726, 2.0652919936180116, 9.0072386858615019,  },
+         { { 0,2 }, 3.0000000000000000, 2.9769892692565918, 2.9510902166366577, 6.0913075734509032,  },
+         { { 0,3 }, 4.0000000000000000, 3.9142239093780518, 3.8679745817184448, 9.9024621200418093,  },
+         { { 2,0 }, 9.0000000000000000, 8.5226116180419922, 8.8801899719238264, 7.1670624659542899,  },
+         { { 2,1 }, 10.0000000000000000, 9.3106842041015625, 9.9872398185729985, 9.0473697210863744,  },
+         { { 2,2 }, 11.0000000000000000, 10.4211254119873047, 10.9882959938049360, 11.0497280209368984,  },
+         { { 2,3 }, 12.0000000000000000, 12.3409175872802734, 12.0858093643188482, 8.7722918525955951,  },
       }
   }
 },
 { 523,
-  { 0.1137900367618328,
+  { 0.1137898973960926,
       {
-         { { 0,0 }, 1.0000000000000000, 0.9808684587478638, 1.1730685758590695, 6.9784382229906354,  },
-         { { 0,1 }, 2.0000000000000000, 1.3404833078384399, 2.1159331727027895, 9.3840558037882289,  },
-         { { 0,2 }, 3.0000000000000000, 2.9322106838226318, 2.9700167608261108, 5.2415722392638253,  },
-         { { 0,3 }, 4.0000000000000000, 4.1163573265075684, 3.7936163663864133, 10.6358775008236783,  },
-         { { 2,0 }, 9.0000000000000000, 9.1376562118530273, 8.9281469917297365, 10.2329757786894575,  },
-         { { 2,1 }, 10.0000000000000000, 9.7247180938720703, 9.9921588897705043, 9.1134652284345066,  },
-         { { 2,2 }, 11.0000000000000000, 10.1835937500000000, 10.9061821365356462, 7.8550384559664339,  },
-         { { 2,3 }, 12.0000000000000000, 12.1072368621826172, 12.0516993141174336, 9.3527793467994531,  },
+         { { 0,0 }, 1.0000000000000000, 0.9808645248413086, 1.1731045997142793, 6.9787839102105007,  },
+         { { 0,1 }, 2.0000000000000000, 1.3405157327651978, 2.1159430885314934, 9.3831612812917502,  },
+         { { 0,2 }, 3.0000000000000000, 2.9321813583374023, 2.9700335288047786, 5.2413705086719498,  },
+         { { 0,3 }, 4.0000000000000000, 4.1163706779479980, 3.7936432838439931, 10.6364867646387840,  },
+         { { 2,0 }, 9.0000000000000000, 9.1377134323120117, 8.9281496238708495, 10.2329975500598955,  },
+         { { 2,1 }, 10.0000000000000000, 9.7247657775878906, 9.9921413040161173, 9.1131537262666082,  },
+         { { 2,2 }, 11.0000000000000000, 10.1835651397705078, 10.9061736106872598, 7.8552680289581218,  },
+         { { 2,3 }, 12.0000000000000000, 12.1071538925170898, 12.0516566848754874, 9.3527075490982678,  },
       }
   }
 },
 { 577,
-  { 0.8621712457322759,
+  { 0.8621712440086192,
       {
-         { { 0,0 }, 1.0000000000000000, 1.9575315713882446, 1.9754841327667236, 1.7968209059108353,  },
-         { { 0,1 }, 2.0000000000000000, 2.0790467262268066, 2.2486999726295474, 2.7890463509836270,  },
-         { { 0,2 }, 3.0000000000000000, 2.3673813343048096, 2.5602953433990483, 3.3724335668638332,  },
-         { { 0,3 }, 4.0000000000000000, 2.6885392665863037, 2.8587298440933213, 3.4947863487486162,  },
-         { { 2,0 }, 9.0000000000000000, 8.2817668914794922, 7.8675784873962389, 7.3064969305182625,  },
-         { { 2,1 }, 10.0000000000000000, 8.7958631515502930, 8.9461545944213849, 8.0947633924151852,  },
-         { { 2,2 }, 11.0000000000000000, 10.0157260894775391, 10.1858595848083500, 6.5219407461358951,  },
-         { { 2,3 }, 12.0000000000000000, 11.3744554519653320, 11.3822119331359843, 7.7491558009056654,  },
+         { { 0,0 }, 1.0000000000000000, 1.9575315713882446, 1.9754841327667239, 1.7968209810635187,  },
+         { { 0,1 }, 2.0000000000000000, 2.0790467262268066, 2.2486999869346618, 2.7890459211625758,  },
+         { { 0,2 }, 3.0000000000000000, 2.3673813343048096, 2.5602953624725342, 3.3724332534884347,  },
+         { { 0,3 }, 4.0000000000000000, 2.6885392665863037, 2.8587298536300647, 3.4947861169041974,  },
+         { { 2,0 }, 9.0000000000000000, 8.2817668914794922, 7.8675784492492662, 7.3064976427779724,  },
+         { { 2,1 }, 10.0000000000000000, 8.7958631515502930, 8.9461546134948779, 8.0947603624890441,  },
+         { { 2,2 }, 11.0000000000000000, 10.0157260894775391, 10.1858596229553218, 6.5219387276764058,  },
+         { { 2,3 }, 12.0000000000000000, 11.3744554519653320, 11.3822119140625002, 7.7491534572937999,  },
       }
   }
 },
 { 629,
-  { 0.9236974593345043,
+  { 0.9236974749113587,
       {
-         { { 0,0 }, 1.0000000000000000, 1.9532738924026489, 1.9987836647033690, 1.8905524119076562,  },
-         { { 0,1 }, 2.0000000000000000, 2.0194809436798096, 2.2403431534767142, 3.1881783872665141,  },
-         { { 0,2 }, 3.0000000000000000, 2.2763950824737549, 2.5145437645912172, 3.4107583141290667,  },
-         { { 0,3 }, 4.0000000000000000, 2.5708334445953369, 2.8077803802490222, 4.2687640086168406,  },
-         { { 2,0 }, 9.0000000000000000, 8.2899208068847656, 7.9423309040069601, 6.9946252827158037,  },
-         { { 2,1 }, 10.0000000000000000, 8.5709114074707031, 8.8918395709991422, 11.8782285260349543,  },
-         { { 2,2 }, 11.0000000000000000, 9.6612844467163086, 9.9821767044067400, 7.5514154634562853,  },
-         { { 2,3 }, 12.0000000000000000, 10.9109144210815430, 11.1451905250549306, 8.9001136496122175,  },
+         { { 0,0 }, 1.0000000000000000, 1.9532738924026489, 1.9987836909294125, 1.8905528168039614,  },
+         { { 0,1 }, 2.0000000000000000, 2.0194809436798096, 2.2403431200981134, 3.1881777709948365,  },
+         { { 0,2 }, 3.0000000000000000, 2.2763950824737549, 2.5145437812805178, 3.4107580762883964,  },
+         { { 0,3 }, 4.0000000000000000, 2.5708334445953369, 2.8077803516387934, 4.2687637441434587,  },
+         { { 2,0 }, 9.0000000000000000, 8.2899208068847656, 7.9423309326171907, 6.9946262894882416,  },
+         { { 2,1 }, 10.0000000000000000, 8.5709114074707031, 8.8918394565582233, 11.8782229380141313,  },
+         { { 2,2 }, 11.0000000000000000, 9.6612844467163086, 9.9821767616271977, 7.5514167987193863,  },
+         { { 2,3 }, 12.0000000000000000, 10.9109144210815430, 11.1451904869079588, 8.9001130701177544,  },
       }
   }
 },
 { 685,
-  { 0.7884333039617102,
+  { 0.7884331339324682,
       {
-         { { 0,0 }, 1.0000000000000000, 1.9449148178100586, 1.7217961263656618, 3.1608079756231695,  },
-         { { 0,1 }, 2.0000000000000000, 2.0755224227905273, 2.2238149571418773, 3.2861884166159241,  },
-         { { 0,2 }, 3.0000000000000000, 2.5638713836669922, 2.6193810081481939, 4.1374230053746208,  },
-         { { 0,3 }, 4.0000000000000000, 2.7153325080871582, 3.0339054536819452, 4.8614733189664650,  },
-         { { 2,0 }, 9.0000000000000000, 8.0762147903442383, 7.8228815937042206, 7.6069057873234058,  },
-         { { 2,1 }, 10.0000000000000000, 8.6185588836669922, 8.9777284622192379, 9.5911804508050356,  },
-         { { 2,2 }, 11.0000000000000000, 10.6464166641235352, 10.2770127487182652, 7.1522249683054389,  },
-         { { 2,3 }, 12.0000000000000000, 11.2753553390502930, 11.3914222145080544, 6.8364200240565234,  },
+         { { 0,0 }, 1.0000000000000000, 1.9449148178100586, 1.7217956256866456, 3.1608122657579001,  },
+         { { 0,1 }, 2.0000000000000000, 2.0755224227905273, 2.2238147759437563, 3.2861888826553560,  },
+         { { 0,2 }, 3.0000000000000000, 2.5638713836669922, 2.6193809461593633, 4.1374250816742766,  },
+         { { 0,3 }, 4.0000000000000000, 2.7153325080871582, 3.0339058494567865, 4.8614727097897399,  },
+         { { 2,0 }, 9.0000000000000000, 8.0762147903442383, 7.8228820610046395, 7.6069099755011615,  },
+         { { 2,1 }, 10.0000000000000000, 8.6185588836669922, 8.9777283859252943, 9.5911775882491241,  },
+         { { 2,2 }, 11.0000000000000000, 10.6464166641235352, 10.2770127677917458, 7.1522296201354267,  },
+         { { 2,3 }, 12.0000000000000000, 11.2753553390502930, 11.3914219284057623, 6.8364250422705641,  },
       }
   }
 },
 { 741,
-  { 0.9407115182688675,
+  { 0.9407115188156173,
       {
-         { { 0,0 }, 1.0000000000000000, 1.9223177433013916, 1.9177904486656188, 2.2597156636117366,  },
-         { { 0,1 }, 2.0000000000000000, 2.1835479736328125, 2.2278415179252620, 2.5067000602658891,  },
-         { { 0,2 }, 3.0000000000000000, 2.3642838001251221, 2.5613916587829588, 3.9755796032699253,  },
-         { { 0,3 }, 4.0000000000000000, 2.8651094436645508, 2.8463130187988281, 4.2418391699875251,  },
-         { { 2,0 }, 9.0000000000000000, 7.6026511192321777, 7.6694858169555662, 6.6320110202637963,  },
-         { { 2,1 }, 10.0000000000000000, 8.6358013153076172, 8.8241317939758339, 8.1743607406909948,  },
-         { { 2,2 }, 11.0000000000000000, 9.3506002426147461, 10.0552910804748521, 10.4582873512049499,  },
-         { { 2,3 }, 12.0000000000000000, 11.3313360214233398, 11.2148412132263200, 8.5308856982785297,  },
+         { { 0,0 }, 1.0000000000000000, 1.9223179817199707, 1.9177903509140015, 2.2597153900754630,  },
+         { { 0,1 }, 2.0000000000000000, 2.1835482120513916, 2.2278414440155028, 2.5066988471530225,  },
+         { { 0,2 }, 3.0000000000000000, 2.3642840385437012, 2.5613916420936578, 3.9755792803525769,  },
+         { { 0,3 }, 4.0000000000000000, 2.8651103973388672, 2.8463129568099985, 4.2418371123833039,  },
+         { { 2,0 }, 9.0000000000000000, 7.6026511192321777, 7.6694858932495116, 6.6320116342578475,  },
+         { { 2,1 }, 10.0000000000000000, 8.6358013153076172, 8.8241317749023462, 8.1743654911479169,  },
+         { { 2,2 }, 11.0000000000000000, 9.3506002426147461, 10.0552910423278803, 10.4582887303222609,  },
+         { { 2,3 }, 12.0000000000000000, 11.3313379287719727, 11.2148411178588852, 8.5308832436995718,  },
       }
   }
 },
 { 795,
-  { 0.2371823275682263,
+  { 0.2371819440114245,
       {
-         { { 0,0 }, 1.0000000000000000, 1.9618719816207886, 1.4931096339225771, 7.4984939354224913,  },
-         { { 0,1 }, 2.0000000000000000, 1.5820143222808838, 2.0782096433639530, 6.1185259358545387,  },
-         { { 0,2 }, 3.0000000000000000, 2.3384132385253906, 2.8072542762756343, 8.5678808144797749,  },
-         { { 0,3 }, 4.0000000000000000, 4.3314070701599121, 3.6240928936004639, 9.0850393513592778,  },
-         { { 2,0 }, 9.0000000000000000, 8.9051752090454102, 8.8595775127410903, 14.8792875028585563,  },
-         { { 2,1 }, 10.0000000000000000, 10.5367145538330078, 9.9617767524719216, 10.9655690769695724,  },
-         { { 2,2 }, 11.0000000000000000, 11.6340742111206055, 11.0331952095031731, 6.1197434163009303,  },
-         { { 2,3 }, 12.0000000000000000, 11.8261003494262695, 12.0055957603454608, 6.4745178916074853,  },
+         { { 0,0 }, 1.0000000000000000, 1.9618734121322632, 1.4931093275547023, 7.4984627038941056,  },
+         { { 0,1 }, 2.0000000000000000, 1.5820174217224121, 2.0782086849212651, 6.1185091840258998,  },
+         { { 0,2 }, 3.0000000000000000, 2.3384118080139160, 2.8072542500495907, 8.5678120920265179,  },
+         { { 0,3 }, 4.0000000000000000, 4.3313903808593750, 3.6240940141677860, 9.0850306541425958,  },
+         { { 2,0 }, 9.0000000000000000, 8.9051761627197266, 8.8595778560638418, 14.8792476713406856,  },
+         { { 2,1 }, 10.0000000000000000, 10.5367174148559570, 9.9617772102355957, 10.9655615643046112,  },
+         { { 2,2 }, 11.0000000000000000, 11.6340732574462891, 11.0331946945190431, 6.1197323510302546,  },
+         { { 2,3 }, 12.0000000000000000, 11.8260898590087891, 12.0055952644348150, 6.4745258923274536,  },
       }
   }
 },
 { 847,
-  { 0.1671257232710754,
+  { 0.1671254891405881,
       {
-         { { 0,0 }, 1.0000000000000000, 0.9178731441497803, 1.2601818752288823, 9.3254404868444229,  },
-         { { 0,1 }, 2.0000000000000000, 2.5445919036865234, 2.1833934187889108, 8.0362827956192628,  },
-         { { 0,2 }, 3.0000000000000000, 3.4462718963623047, 2.9740832328796394, 4.7196468094209614,  },
-         { { 0,3 }, 4.0000000000000000, 3.0958552360534668, 3.6647080039978022, 7.1152917061645127,  },
-         { { 2,0 }, 9.0000000000000000, 8.9686450958251953, 8.9990673255920424, 12.8286318763011753,  },
-         { { 2,1 }, 10.0000000000000000, 10.5873422622680664, 9.9955418777465788, 13.4674621978837123,  },
-         { { 2,2 }, 11.0000000000000000, 11.9557962417602539, 10.9973862266540507, 8.3243153135150578,  },
-         { { 2,3 }, 12.0000000000000000, 12.2158651351928711, 11.9051299476623544, 8.0325597756167717,  },
+         { { 0,0 }, 1.0000000000000000, 0.9178628921508789, 1.2601812386512758, 9.3254210231471042,  },
+         { { 0,1 }, 2.0000000000000000, 2.5445916652679443, 2.1833935642242430, 8.0362807121404671,  },
+         { { 0,2 }, 3.0000000000000000, 3.4462742805480957, 2.9740832948684690, 4.7196705382620170,  },
+         { { 0,3 }, 4.0000000000000000, 3.0958571434020996, 3.6647084760665898, 7.1152832345295716,  },
+         { { 2,0 }, 9.0000000000000000, 8.9686470031738281, 8.9990674400329560, 12.8286410091896048,  },
+         { { 2,1 }, 10.0000000000000000, 10.5873422622680664, 9.9955421066284167, 13.4674577294720788,  },
+         { { 2,2 }, 11.0000000000000000, 11.9557933807373047, 10.9973863792419415, 8.3243109258839265,  },
+         { { 2,3 }, 12.0000000000000000, 12.2158575057983398, 11.9051300811767593, 8.0325529121026804,  },
       }
   }
 },
 { 903,
-  { 0.1324738449124023,
+  { 0.1324738282867361,
       {
-         { { 0,0 }, 1.0000000000000000, 1.2219840288162231, 1.0874230360984805, 7.2059945300133794,  },
-         { { 0,1 }, 2.0000000000000000, 2.2499980926513672, 2.1247424435615545, 6.3823559172566675,  },
-         { { 0,2 }, 3.0000000000000000, 2.6824562549591064, 2.9819613218307492, 8.6546363788111442,  },
-         { { 0,3 }, 4.0000000000000000, 2.9659447669982910, 4.0099428176879899, 9.2841192810212743,  },
-         { { 2,0 }, 9.0000000000000000, 8.7328014373779297, 8.7295580291748038, 10.8661394881072990,  },
-         { { 2,1 }, 10.0000000000000000, 9.1181011199951172, 9.8092939758300801, 10.0676662520264717,  },
-         { { 2,2 }, 11.0000000000000000, 10.5953502655029297, 10.9714189529418924, 7.8383395687524153,  },
-         { { 2,3 }, 12.0000000000000000, 12.1112499237060547, 12.0802640342712433, 8.3541941056781326,  },
+         { { 0,0 }, 1.0000000000000000, 1.2219830751419067, 1.0874230098724367, 7.2059995640466239,  },
+         { { 0,1 }, 2.0000000000000000, 2.2499985694885254, 2.1247428488731379, 6.3823856097044978,  },
+         { { 0,2 }, 3.0000000000000000, 2.6824579238891602, 2.9819608688354493, 8.6545992150957964,  },
+         { { 0,3 }, 4.0000000000000000, 2.9659435749053955, 4.0099423074722287, 9.2840621510253420,  },
+         { { 2,0 }, 9.0000000000000000, 8.7328052520751953, 8.7295587635040306, 10.8661561379339826,  },
+         { { 2,1 }, 10.0000000000000000, 9.1181058883666992, 9.8092934226989783, 10.0676316276796900,  },
+         { { 2,2 }, 11.0000000000000000, 10.5953474044799805, 10.9714197158813498, 7.8383919861553313,  },
+         { { 2,3 }, 12.0000000000000000, 12.1112461090087891, 12.0802646064758310, 8.3541345336820321,  },
       }
   }
 },
 { 959,
-  { 0.1107117770609861,
+  { 0.1107113570839734,
       {
-         { { 0,0 }, 1.0000000000000000, 1.6594473123550415, 1.1279158079624176, 10.9376519990886862,  },
-         { { 0,1 }, 2.0000000000000000, 2.4226012229919434, 2.1043652725219730, 8.9825833741377856,  },
-         { { 0,2 }, 3.0000000000000000, 3.0228502750396729, 2.9059820795059208, 8.0184940619992400,  },
-         { { 0,3 }, 4.0000000000000000, 3.2661445140838623, 3.9062563514709470, 9.4141651218788862,  },
-         { { 2,0 }, 9.0000000000000000, 8.8221864700317383, 8.8623872470855680, 9.5042111810271219,  },
-         { { 2,1 }, 10.0000000000000000, 9.0866622924804688, 9.8407818412780745, 7.4459065425646278,  },
-         { { 2,2 }, 11.0000000000000000, 10.6470108032226562, 10.9078655815124517, 9.0628491473824617,  },
-         { { 2,3 }, 12.0000000000000000, 12.1812973022460938, 11.9800367164611856, 10.2637321400461747,  },
+         { { 0,0 }, 1.0000000000000000, 1.6594462394714355, 1.1279137873649596, 10.9376335216205227,  },
+         { { 0,1 }, 2.0000000000000000, 2.4225792884826660, 2.1043638944625855, 8.9825825798860688,  },
+         { { 0,2 }, 3.0000000000000000, 3.0228409767150879, 2.9059835052490239, 8.0185472936435183,  },
+         { { 0,3 }, 4.0000000000000000, 3.2661571502685547, 3.9062568902969361, 9.4141612280600668,  },
+         { { 2,0 }, 9.0000000000000000, 8.8221721649169922, 8.8623857021331780, 9.5042398067117819,  },
+         { { 2,1 }, 10.0000000000000000, 9.0866413116455078, 9.8407822799682645, 7.4459730889150615,  },
+         { { 2,2 }, 11.0000000000000000, 10.6470088958740234, 10.9078651046752952, 9.0628526292278586,  },
+         { { 2,3 }, 12.0000000000000000, 12.1813058853149414, 11.9800353050231934, 10.2637631656930282,  },
       }
   }
 },
 { 1018,
-  { 0.1328838900605362,
+  { 0.1329017461932643,
       {
-         { { 0,0 }, 1.0000000000000000, 1.2269239425659180, 1.2475296783447263, 6.5778490867571637,  },
-         { { 0,1 }, 2.0000000000000000, 1.3555712699890137, 2.0655877971649166, 7.7250845052273913,  },
-         { { 0,2 }, 3.0000000000000000, 2.8025016784667969, 3.0198775339126578, 6.1185122071517632,  },
-         { { 0,3 }, 4.0000000000000000, 4.0298480987548828, 3.8136768960952758, 5.7903076503577955,  },
-         { { 2,0 }, 9.0000000000000000, 9.1961002349853516, 8.8216819000244104, 7.4131613186652308,  },
-         { { 2,1 }, 10.0000000000000000, 10.1860103607177734, 9.9838342857360836, 12.4844229519303394,  },
-         { { 2,2 }, 11.0000000000000000, 11.0682182312011719, 10.9267002487182623, 7.1708504823668591,  },
-         { { 2,3 }, 12.0000000000000000, 12.6927604675292969, 12.0561193466186527, 6.3332948328479599,  },
+         { { 0,0 }, 1.0000000000000000, 1.2269759178161621, 1.2475560641288757, 6.5789337746474024,  },
+         { { 0,1 }, 2.0000000000000000, 1.3555865287780762, 2.0655989837646489, 7.7249335931406975,  },
+         { { 0,2 }, 3.0000000000000000, 2.8025197982788086, 3.0198900938034061, 6.1186108442837215,  },
+         { { 0,3 }, 4.0000000000000000, 4.0298762321472168, 3.8136691999435430, 5.7908647198049090,  },
+         { { 2,0 }, 9.0000000000000000, 9.1961135864257812, 8.8216345024108875, 7.4126876674659723,  },
+         { { 2,1 }, 10.0000000000000000, 10.1860618591308594, 9.9838055038452129, 12.4851730298948684,  },
+         { { 2,2 }, 11.0000000000000000, 11.0682373046875000, 10.9267174148559576, 7.1708880015626359,  },
+         { { 2,3 }, 12.0000000000000000, 12.6927471160888672, 12.0561616325378420, 6.3325056550726178,  },
       }
   }
 },
 { 1075,
-  { 0.1889562057707030,
+  { 0.1463089787335559,
       {
-         { { 0,0 }, 1.0000000000000000, 1.6487320661544800, 1.3232716310024262, 9.2591395452477272,  },
-         { { 0,1 }, 2.0000000000000000, 1.9500912427902222, 2.1212366843223576, 8.5651265690041374,  },
-         { { 0,2 }, 3.0000000000000000, 3.1598086357116699, 2.8929933428764341, 8.9117227978470641,  },
-         { { 0,3 }, 4.0000000000000000, 3.9104304313659668, 3.6456405305862432, 5.6427211555434988,  },
-         { { 2,0 }, 9.0000000000000000, 8.4762334823608398, 8.8966452598571788, 6.7130764296875931,  },
-         { { 2,1 }, 10.0000000000000000, 10.1570196151733398, 9.9017084884643563, 12.9020773931781996,  },
-         { { 2,2 }, 11.0000000000000000, 11.4234476089477539, 10.9092822837829591, 6.9957636338278260,  },
-         { { 2,3 }, 12.0000000000000000, 11.6239547729492188, 12.0289571189880373, 9.4018405525053801,  },
+         { { 0,0 }, 1.0000000000000000, 1.4741218090057373, 1.2689476656913758, 6.3851408455166450,  },
+         { { 0,1 }, 2.0000000000000000, 2.2722375392913818, 2.1310384559631341, 5.8620708260819914,  },
+         { { 0,2 }, 3.0000000000000000, 3.0074679851531982, 2.9876283550262457, 9.4495729339637577,  },
+         { { 0,3 }, 4.0000000000000000, 3.8806343078613281, 3.8350142526626581, 4.8361316930872675,  },
+         { { 2,0 }, 9.0000000000000000, 9.4793672561645508, 8.7882205867767347, 12.3082227055869691,  },
+         { { 2,1 }, 10.0000000000000000, 10.2074661254882812, 9.9988953781127918, 8.8498409435397356,  },
+         { { 2,2 }, 11.0000000000000000, 10.6450958251953125, 10.9500217247009317, 7.0732142533733899,  },
+         { { 2,3 }, 12.0000000000000000, 11.8915376663208008, 12.0838074684143066, 13.7554016909548480,  },
       }
   }
 },
 { 1135,
-  { 0.3342635580337815,
+  { 0.3342455868472406,
       {
-         { { 0,0 }, 1.0000000000000000, 0.6690139174461365, 1.0497028923034668, 9.5645368516812788,  },
-         { { 0,1 }, 2.0000000000000000, 1.9708448648452759, 1.9458280110359190, 15.8050428809590322,  },
-         { { 0,2 }, 3.0000000000000000, 3.3009686470031738, 2.5676243305206290, 15.2467788877937664,  },
-         { { 0,3 }, 4.0000000000000000, 3.1061937808990479, 3.2771965622901922, 24.1468992916062497,  },
-         { { 2,0 }, 9.0000000000000000, 9.3714389801025391, 8.7254815959930401, 10.2201004468459988,  },
-         { { 2,1 }, 10.0000000000000000, 9.6468820571899414, 9.6914222908020005, 15.4182459597863186,  },
-         { { 2,2 }, 11.0000000000000000, 11.3023166656494141, 10.9085120773315385, 17.3482342127226126,  },
-         { { 2,3 }, 12.0000000000000000, 11.9833106994628906, 11.9896124076843265, 12.3092838780806968,  },
+         { { 0,0 }, 1.0000000000000000, 0.6691265702247620, 1.0496667814254763, 9.5641694707738338,  },
+         { { 0,1 }, 2.0000000000000000, 1.9706945419311523, 1.9458189845085141, 15.7989677581139780,  },
+         { { 0,2 }, 3.0000000000000000, 3.3010025024414062, 2.5676877307891846, 15.2468758803476163,  },
+         { { 0,3 }, 4.0000000000000000, 3.1060667037963867, 3.2772368645668024, 24.1411041051352022,  },
+         { { 2,0 }, 9.0000000000000000, 9.3715095520019531, 8.7254648399353005, 10.2205052156832448,  },
+         { { 2,1 }, 10.0000000000000000, 9.6471061706542969, 9.6914249992370642, 15.4202098460529786,  },
+         { { 2,2 }, 11.0000000000000000, 11.3021860122680664, 10.9084481811523446, 17.3478923017154756,  },
+         { { 2,3 }, 12.0000000000000000, 11.9835348129272461, 11.9895952796936012, 12.3137690842031589,  },
       }
   }
 },
 { 1193,
-  { 0.3351872795817737,
+  { 0.3352537349248208,
       {
-         { { 0,0 }, 1.0000000000000000, 0.7896833419799805, 1.6154930019378666, 13.0590963094029782,  },
-         { { 0,1 }, 2.0000000000000000, 1.9420514106750488, 2.1307498240470886, 6.3364042903937863,  },
-         { { 0,2 }, 3.0000000000000000, 2.6336133480072021, 2.9457474660873406, 6.1732713167417472,  },
-         { { 0,3 }, 4.0000000000000000, 2.9405641555786133, 3.4124695539474486, 10.1359267152354597,  },
-         { { 2,0 }, 9.0000000000000000, 8.4036026000976562, 8.6715880584716807, 10.0168830384252701,  },
-         { { 2,1 }, 10.0000000000000000, 10.0089416503906250, 10.0103047943115229, 8.0603839254558913,  },
-         { { 2,2 }, 11.0000000000000000, 10.0208091735839844, 10.7956970596313511, 8.1111273472331433,  },
-         { { 2,3 }, 12.0000000000000000, 11.6149921417236328, 11.9289978790283229, 11.1598332339465642,  },
+         { { 0,0 }, 1.0000000000000000, 0.7903516292572021, 1.6157905185222630, 13.0519741232519149,  },
+         { { 0,1 }, 2.0000000000000000, 1.9430673122406006, 2.1305340552330012, 6.3343607024583948,  },
+         { { 0,2 }, 3.0000000000000000, 2.6354358196258545, 2.9457736825942997, 6.1696449758033651,  },
+         { { 0,3 }, 4.0000000000000000, 2.9417510032653809, 3.4124885034561157, 10.1250715592956020,  },
+         { { 2,0 }, 9.0000000000000000, 8.4047946929931641, 8.6714429664611803, 10.0250180644811540,  },
+         { { 2,1 }, 10.0000000000000000, 10.0094871520996094, 10.0103102684021010, 8.0555614930494759,  },
+         { { 2,2 }, 11.0000000000000000, 10.0208654403686523, 10.7957384681701658, 8.1058337323589704,  },
+         { { 2,3 }, 12.0000000000000000, 11.6167707443237305, 11.9290466308593786, 11.1546123422885834,  },
       }
   }
 },
 { 1250,
-  { 0.1470845313532315,
+  { 0.1470948466556164,
       {
-         { { 0,0 }, 1.0000000000000000, 1.7158793210983276, 1.2788221752643587, 8.4034418906472297,  },
-         { { 0,1 }, 2.0000000000000000, 2.8633291721343994, 2.0889865994453429, 7.5875865528104001,  },
-         { { 0,2 }, 3.0000000000000000, 2.9068207740783691, 2.8886589169502255, 6.7511222743897914,  },
-         { { 0,3 }, 4.0000000000000000, 3.8210189342498779, 3.8668260622024535, 13.8095023460132875,  },
-         { { 2,0 }, 9.0000000000000000, 9.1866626739501953, 8.7824043083190908, 7.1810842312663947,  },
-         { { 2,1 }, 10.0000000000000000, 9.1734724044799805, 9.9827038383483870, 7.5347519217877705,  },
-         { { 2,2 }, 11.0000000000000000, 11.1531867980957031, 10.9166299438476564, 9.2546730590299582,  },
-         { { 2,3 }, 12.0000000000000000, 12.1177940368652344, 11.9482244110107398, 10.8587057724012226,  },
+         { { 0,0 }, 1.0000000000000000, 1.7159947156906128, 1.2788347899913786, 8.4030371209160339,  },
+         { { 0,1 }, 2.0000000000000000, 2.8635704517364502, 2.0889576554298408, 7.5853898462614548,  },
+         { { 0,2 }, 3.0000000000000000, 2.9067058563232422, 2.8886656332015987, 6.7528891909787134,  },
+         { { 0,3 }, 4.0000000000000000, 3.8213005065917969, 3.8667771768569943, 13.8100620457732379,  },
+         { { 2,0 }, 9.0000000000000000, 9.1867637634277344, 8.7823544502258279, 7.1810680155131230,  },
+         { { 2,1 }, 10.0000000000000000, 9.1730356216430664, 9.9827341651916530, 7.5329607634288811,  },
+         { { 2,2 }, 11.0000000000000000, 11.1534690856933594, 10.9166696929931604, 9.2527988809894914,  },
+         { { 2,3 }, 12.0000000000000000, 12.1177434921264648, 11.9482549476623561, 10.8582337988571513,  },
       }
   }
 },
 { 1305,
-  { 0.1715667008433966,
+  { 0.1715684100952284,
       {
-         { { 0,0 }, 1.0000000000000000, 2.0011949539184570, 1.3034660899639130, 7.0016470072692929,  },
-         { { 0,1 }, 2.0000000000000000, 2.3058633804321289, 2.1053875470161447, 5.9255280790173321,  },
-         { { 0,2 }, 3.0000000000000000, 3.3230326175689697, 2.9678603363037110, 5.1185865290930517,  },
-         { { 0,3 }, 4.0000000000000000, 4.2615380287170410, 3.8038762760162359, 7.6498811098271355,  },
-         { { 2,0 }, 9.0000000000000000, 8.2469892501831055, 8.7779881477355932, 8.3462499087640882,  },
-         { { 2,1 }, 10.0000000000000000, 9.4746971130371094, 9.8009578132629418, 6.3183260137757502,  },
-         { { 2,2 }, 11.0000000000000000, 10.8697013854980469, 10.9513729667663569, 8.9357818609478450,  },
-         { { 2,3 }, 12.0000000000000000, 11.7959079742431641, 12.0389068603515579, 6.1262144604443121,  },
+         { { 0,0 }, 1.0000000000000000, 2.0012433528900146, 1.3034703934192657, 7.0017456431209828,  },
+         { { 0,1 }, 2.0000000000000000, 2.3058423995971680, 2.1053846907615670, 5.9254859197602929,  },
+         { { 0,2 }, 3.0000000000000000, 3.3230288028717041, 2.9678574848175048, 5.1185911121622478,  },
+         { { 0,3 }, 4.0000000000000000, 4.2615346908569336, 3.8038711643218992, 7.6499106377617583,  },
+         { { 2,0 }, 9.0000000000000000, 8.2469673156738281, 8.7779871940612786, 8.3461705356553466,  },
+         { { 2,1 }, 10.0000000000000000, 9.4747085571289062, 9.8009569740295372, 6.3182967089502275,  },
+         { { 2,2 }, 11.0000000000000000, 10.8697013854980469, 10.9513746261596658, 8.9358379156128684,  },
+         { { 2,3 }, 12.0000000000000000, 11.7958736419677734, 12.0389055442810058, 6.1263454407127709,  },
       }
   }
 },
 { 1466,
-  { 0.4735015365877756,
+  { 0.4735018315971984,
       {
-         { { 0,0 }, 1.0000000000000000, 2.2545890808105469, 1.9588016152381900, 2.7008157067061012,  },
-         { { 0,1 }, 2.0000000000000000, 2.4966435432434082, 2.1417748570442199, 3.7451830017908030,  },
-         { { 0,2 }, 3.0000000000000000, 2.7962179183959961, 2.4119299173355100, 4.4454922143990254,  },
-         { { 0,3 }, 4.0000000000000000, 3.4513328075408936, 3.6057628583908077, 7.5470115985903083,  },
-         { { 2,0 }, 9.0000000000000000, 8.9077911376953125, 8.4682523250579820, 8.9192249521225957,  },
-         { { 2,1 }, 10.0000000000000000, 10.3199405670166016, 9.7622254943847651, 7.0501802766934825,  },
-         { { 2,2 }, 11.0000000000000000, 11.4827594757080078, 10.9952775001525946, 7.7908106263698649,  },
-         { { 2,3 }, 12.0000000000000000, 12.4198026657104492, 12.1168975639343230, 9.3907638679929590,  },
+         { { 0,0 }, 1.0000000000000000, 2.2545912265777588, 1.9588021016120909, 2.7008224167894497,  },
+         { { 0,1 }, 2.0000000000000000, 2.4966440200805664, 2.1417753028869622, 3.7451997119492573,  },
+         { { 0,2 }, 3.0000000000000000, 2.7962183952331543, 2.4119304013252258, 4.4455089634959011,  },
+         { { 0,3 }, 4.0000000000000000, 3.4513397216796875, 3.6057614088058463, 7.5470372904983645,  },
+         { { 2,0 }, 9.0000000000000000, 8.9077911376953125, 8.4682522964477513, 8.9192262865833616,  },
+         { { 2,1 }, 10.0000000000000000, 10.3199405670166016, 9.7622252655029271, 7.0501820651854903,  },
+         { { 2,2 }, 11.0000000000000000, 11.4827585220336914, 10.9952771186828606, 7.7907951656347922,  },
+         { { 2,3 }, 12.0000000000000000, 12.4198026657104492, 12.1168995285034136, 9.3907869981339207,  },
       }
   }
 },
 { 1518,
-  { 0.5789917447929205,
+  { 0.5789917505058754,
       {
-         { { 0,0 }, 1.0000000000000000, 2.0927941799163818, 2.1384695672988894, 1.5892688975158322,  },
-         { { 0,1 }, 2.0000000000000000, 2.4580066204071045, 2.4738928532600402, 2.2739988193341913,  },
-         { { 0,2 }, 3.0000000000000000, 2.7391102313995361, 2.7950172615051265, 3.0196044256244741,  },
-         { { 0,3 }, 4.0000000000000000, 3.2139525413513184, 3.1235486793518068, 3.5996048221960604,  },
-         { { 2,0 }, 9.0000000000000000, 8.2768297195434570, 8.5654111003875713, 6.8303012832095629,  },
-         { { 2,1 }, 10.0000000000000000, 9.7212152481079102, 9.8129439544677712, 5.0634821380776636,  },
-         { { 2,2 }, 11.0000000000000000, 10.8329572677612305, 11.0935291099548294, 9.5106117526845804,  },
-         { { 2,3 }, 12.0000000000000000, 12.7109193801879883, 12.3440554046630879, 6.2388226142694450,  },
+         { { 0,0 }, 1.0000000000000000, 2.0927953720092773, 2.1384694600105294, 1.5892682007670522,  },
+         { { 0,1 }, 2.0000000000000000, 2.4580070972442627, 2.4738927960395807, 2.2740015360685160,  },
+         { { 0,2 }, 3.0000000000000000, 2.7391111850738525, 2.7950170564651482, 3.0196027026284229,  },
+         { { 0,3 }, 4.0000000000000000, 3.2139534950256348, 3.1235487270355224, 3.5996054964512991,  },
+         { { 2,0 }, 9.0000000000000000, 8.2768335342407227, 8.5654108524322510, 6.8302797022116701,  },
+         { { 2,1 }, 10.0000000000000000, 9.7212162017822266, 9.8129439926147466, 5.0634911893178618,  },
+         { { 2,2 }, 11.0000000000000000, 10.8329591751098633, 11.0935281562805184, 9.5106305184342723,  },
+         { { 2,3 }, 12.0000000000000000, 12.7109222412109375, 12.3440558815002461, 6.2388207220789020,  },
       }
   }
 },
 { 1572,
-  { 0.6208710566197894,
+  { 0.6208710449435558,
       {
-         { { 0,0 }, 1.0000000000000000, 2.2221627235412598, 2.0812328910827635, 2.2354084939962782,  },
-         { { 0,1 }, 2.0000000000000000, 2.3550887107849121, 2.4368027210235592, 2.9276673495463679,  },
-         { { 0,2 }, 3.0000000000000000, 2.6356561183929443, 2.7911745166778563, 4.1899788738468438,  },
-         { { 0,3 }, 4.0000000000000000, 3.1531665325164795, 3.1674059295654300, 4.8473852686875869,  },
-         { { 2,0 }, 9.0000000000000000, 9.1736001968383789, 8.2500019836425764, 7.5410271965512772,  },
-         { { 2,1 }, 10.0000000000000000, 9.7223501205444336, 9.6594099807739244, 8.0635448856032568,  },
-         { { 2,2 }, 11.0000000000000000, 10.8805961608886719, 11.0588717079162571, 9.9782263215169298,  },
-         { { 2,3 }, 12.0000000000000000, 13.0169992446899414, 12.5524493980407748, 8.0264890887677982,  },
+         { { 0,0 }, 1.0000000000000000, 2.2221627235412598, 2.0812327933311456, 2.2354131710155634,  },
+         { { 0,1 }, 2.0000000000000000, 2.3550889492034912, 2.4368024826049810, 2.9276712426104718,  },
+         { { 0,2 }, 3.0000000000000000, 2.6356565952301025, 2.7911740255355841, 4.1899837413413810,  },
+         { { 0,3 }, 4.0000000000000000, 3.1531667709350586, 3.1674055624008171, 4.8473950395563978,  },
+         { { 2,0 }, 9.0000000000000000, 9.1736011505126953, 8.2500013732910134, 7.5410341179134051,  },
+         { { 2,1 }, 10.0000000000000000, 9.7223510742187500, 9.6594087219238300, 8.0635090133025411,  },
+         { { 2,2 }, 11.0000000000000000, 10.8805990219116211, 11.0588694763183586, 9.9781945896313839,  },
+         { { 2,3 }, 12.0000000000000000, 13.0170001983642578, 12.5524475669860820, 8.0265172641844611,  },
       }
   }
 },
 { 1626,
-  { 0.5867014508243252,
+  { 0.5867009209521183,
       {
-         { { 0,0 }, 1.0000000000000000, 2.2003107070922852, 2.1355339407920839, 1.7177162033552587,  },
-         { { 0,1 }, 2.0000000000000000, 2.6562278270721436, 2.4608413791656507, 2.0998504761615040,  },
-         { { 0,2 }, 3.0000000000000000, 2.8194503784179688, 2.7474666070938105, 2.3468241746531575,  },
-         { { 0,3 }, 4.0000000000000000, 3.3224031925201416, 3.0941095447540277, 3.5956841594056606,  },
-         { { 2,0 }, 9.0000000000000000, 8.5403318405151367, 8.5452038574218783, 10.2545265997826878,  },
-         { { 2,1 }, 10.0000000000000000, 10.3099374771118164, 9.8416943931579581, 6.3124458874103002,  },
-         { { 2,2 }, 11.0000000000000000, 10.9434738159179688, 10.9915364837646479, 7.0896616535387871,  },
-         { { 2,3 }, 12.0000000000000000, 12.8956451416015625, 12.3681768226623543, 6.1864225811421223,  },
+         { { 0,0 }, 1.0000000000000000, 2.2003202438354492, 2.1355353999137883, 1.7176759302903859,  },
+         { { 0,1 }, 2.0000000000000000, 2.6562399864196777, 2.4608370590209963, 2.0998202234997096,  },
+         { { 0,2 }, 3.0000000000000000, 2.8194603919982910, 2.7474616289138800, 2.3467161913855810,  },
+         { { 0,3 }, 4.0000000000000000, 3.3223764896392822, 3.0941023540496815, 3.5955671663742406,  },
+         { { 2,0 }, 9.0000000000000000, 8.5403642654418945, 8.5452113342285188, 10.2539721614657147,  },
+         { { 2,1 }, 10.0000000000000000, 10.3099794387817383, 9.8416787910461441, 6.3120041711457588,  },
+         { { 2,2 }, 11.0000000000000000, 10.9435062408447266, 10.9915197181701672, 7.0893100256312982,  },
+         { { 2,3 }, 12.0000000000000000, 12.8955345153808594, 12.3681520080566383, 6.1870369858293381,  },
       }
   }
 },
 { 1683,
-  { 0.5960445025293643,
+  { 0.5960445639694379,
       {
-         { { 0,0 }, 1.0000000000000000, 2.1759119033813477, 2.1581754040718075, 2.5722615932723505,  },
-         { { 0,1 }, 2.0000000000000000, 2.5507380962371826, 2.4717210674285894, 2.8155138775218975,  },
-         { { 0,2 }, 3.0000000000000000, 2.8806948661804199, 2.8180031633377074, 3.0280152015026700,  },
-         { { 0,3 }, 4.0000000000000000, 3.1365365982055664, 3.1276012563705442, 4.0335872869427716,  },
-         { { 2,0 }, 9.0000000000000000, 8.6249170303344727, 8.4384348487854002, 6.0643725674800599,  },
-         { { 2,1 }, 10.0000000000000000, 10.1106605529785156, 9.6709036064147949, 5.5703606654425872,  },
-         { { 2,2 }, 11.0000000000000000, 11.4185485839843750, 11.0374801445007336, 10.5583482086354419,  },
-         { { 2,3 }, 12.0000000000000000, 12.4326572418212891, 12.2428874778747581, 8.5675457772367487,  },
+         { { 0,0 }, 1.0000000000000000, 2.1759099960327148, 2.1581775927543645, 2.5722351601018163,  },
+         { { 0,1 }, 2.0000000000000000, 2.5507359504699707, 2.4717237329483033, 2.8154857125771069,  },
+         { { 0,2 }, 3.0000000000000000, 2.8806929588317871, 2.8180062389373779, 3.0279869302781171,  },
+         { { 0,3 }, 4.0000000000000000, 3.1365334987640381, 3.1276046323776252, 4.0335372858038321,  },
+         { { 2,0 }, 9.0000000000000000, 8.6249189376831055, 8.4384348964691167, 6.0643820557160621,  },
+         { { 2,1 }, 10.0000000000000000, 10.1106615066528320, 9.6709040451049795, 5.5703579928824860,  },
+         { { 2,2 }, 11.0000000000000000, 11.4185523986816406, 11.0374806594848653, 10.5583605290147400,  },
+         { { 2,3 }, 12.0000000000000000, 12.4326591491699219, 12.2428881263732912, 8.5675435136356306,  },
       }
   }
 },
 { 1738,
-  { 0.6015206857577273,
+  { 0.6015207241087398,
       {
-         { { 0,0 }, 1.0000000000000000, 1.9891231060028076, 2.1211752653121940, 1.3404793673136615,  },
-         { { 0,1 }, 2.0000000000000000, 2.3871064186096191, 2.4450286912918093, 2.0688854483437233,  },
-         { { 0,2 }, 3.0000000000000000, 2.6257603168487549, 2.8199093103408814, 2.8254398148118578,  },
-         { { 0,3 }, 4.0000000000000000, 2.9844748973846436, 3.1395666742324821, 3.3510425215743465,  },
-         { { 2,0 }, 9.0000000000000000, 8.4582901000976562, 8.3997373867034923, 7.1475937212960270,  },
-         { { 2,1 }, 10.0000000000000000, 10.1506223678588867, 9.6763180923461931, 7.2674576360838516,  },
-         { { 2,2 }, 11.0000000000000000, 11.1654434204101562, 11.1548130607604978, 6.3633390342016556,  },
-         { { 2,3 }, 12.0000000000000000, 12.6907949447631836, 12.4215473175048814, 7.3315750563506326,  },
+         { { 0,0 }, 1.0000000000000000, 1.9891228675842285, 2.1211752128601074, 1.3404787456158189,  },
+         { { 0,1 }, 2.0000000000000000, 2.3871061801910400, 2.4450286722183234, 2.0688852856947291,  },
+         { { 0,2 }, 3.0000000000000000, 2.6257603168487549, 2.8199093484878546, 2.8254374390251562,  },
+         { { 0,3 }, 4.0000000000000000, 2.9844751358032227, 3.1395667409896855, 3.3510406181264445,  },
+         { { 2,0 }, 9.0000000000000000, 8.4582881927490234, 8.3997370624542214, 7.1475936553883397,  },
+         { { 2,1 }, 10.0000000000000000, 10.1506204605102539, 9.6763179206848147, 7.2674703247845338,  },
+         { { 2,2 }, 11.0000000000000000, 11.1654424667358398, 11.1548131752014132, 6.3633465644450338,  },
+         { { 2,3 }, 12.0000000000000000, 12.6907949447631836, 12.4215474319457986, 7.3315842823999278,  },
       }
   }
 },
 { 1792,
-  { 0.1856555097469542,
+  { 0.1856685622039813,
       {
-         { { 0,0 }, 1.0000000000000000, 0.9636709094047546, 1.3685893845558166, 11.7943807176151196,  },
-         { { 0,1 }, 2.0000000000000000, 2.3190746307373047, 2.1561435437202450, 8.7903541422771081,  },
-         { { 0,2 }, 3.0000000000000000, 3.4321839809417725, 2.9806976652145387, 10.2705494089997291,  },
-         { { 0,3 }, 4.0000000000000000, 3.8590259552001953, 3.8058762788772587, 8.2483877840063826,  },
-         { { 2,0 }, 9.0000000000000000, 8.7322273254394531, 8.7619641780853286, 7.1833255274406156,  },
-         { { 2,1 }, 10.0000000000000000, 9.5409488677978516, 9.9090604209899897, 13.4247010518655099,  },
-         { { 2,2 }, 11.0000000000000000, 10.9540309906005859, 10.9985016059875491, 11.4949267060832376,  },
-         { { 2,3 }, 12.0000000000000000, 11.0096282958984375, 12.1118700218200654, 8.5207402948641100,  },
+         { { 0,0 }, 1.0000000000000000, 0.9640252590179443, 1.3686159622669221, 11.7956801541508955,  },
+         { { 0,1 }, 2.0000000000000000, 2.3190631866455078, 2.1561037445068361, 8.7883180360099846,  },
+         { { 0,2 }, 3.0000000000000000, 3.4321951866149902, 2.9806924724578852, 10.2714837856582069,  },
+         { { 0,3 }, 4.0000000000000000, 3.8587791919708252, 3.8058284473419191, 8.2511257193497407,  },
+         { { 2,0 }, 9.0000000000000000, 8.7321395874023438, 8.7619354629516550, 7.1828811782426172,  },
+         { { 2,1 }, 10.0000000000000000, 9.5409736633300781, 9.9090813064575176, 13.4269223634134587,  },
+         { { 2,2 }, 11.0000000000000000, 10.9539279937744141, 10.9985004043579089, 11.4972129966066117,  },
+         { { 2,3 }, 12.0000000000000000, 11.0096197128295898, 12.1118832397460903, 8.5208394540056318,  },
       }
   }
 },
 { 1844,
-  { 0.1787994101699170,
+  { 0.1394098826251847,
       {
-         { { 0,0 }, 1.0000000000000000, 1.0642299652099609, 1.3467797076702122, 11.0659028299151760,  },
-         { { 0,1 }, 2.0000000000000000, 2.2482533454895020, 2.1677615833282466, 6.7559096555692797,  },
-         { { 0,2 }, 3.0000000000000000, 3.6683843135833740, 2.9312564373016361, 12.6104241629931284,  },
-         { { 0,3 }, 4.0000000000000000, 3.9208159446716309, 3.7035903120040894, 11.1496196870703752,  },
-         { { 2,0 }, 9.0000000000000000, 8.9521560668945312, 8.9651529884338412, 8.7099143633145992,  },
-         { { 2,1 }, 10.0000000000000000, 9.9192848205566406, 9.9461681938171385, 13.9449402932547137,  },
-         { { 2,2 }, 11.0000000000000000, 10.9867181777954102, 11.0536911964416458, 13.9427810437087079,  },
-         { { 2,3 }, 12.0000000000000000, 10.8869609832763672, 12.0881726455688501, 11.6087958974040557,  },
+         { { 0,0 }, 1.0000000000000000, 1.3570985794067383, 1.2804420042037965, 6.7302452637504313,  },
+         { { 0,1 }, 2.0000000000000000, 2.8915495872497559, 2.0941472768783567, 7.4783161816102410,  },
+         { { 0,2 }, 3.0000000000000000, 3.0106797218322754, 2.9204418373107903, 10.3720654022799383,  },
+         { { 0,3 }, 4.0000000000000000, 4.3328495025634766, 3.7958799505233762, 8.9683043314762685,  },
+         { { 2,0 }, 9.0000000000000000, 9.3255176544189453, 8.8687964820861804, 10.4596860992405958,  },
+         { { 2,1 }, 10.0000000000000000, 9.9754180908203125, 9.9918458557128922, 7.9367487727023409,  },
+         { { 2,2 }, 11.0000000000000000, 11.1619157791137695, 10.9619070625305195, 9.2208127518926783,  },
+         { { 2,3 }, 12.0000000000000000, 11.9357910156250000, 12.0352572631835937, 8.8961833994232418,  },
       }
   }
 },
 { 1898,
-  { 0.8621712432646613,
+  { 0.8621712178131727,
       {
-         { { 0,0 }, 1.0000000000000000, 1.9575315713882446, 1.9754841303825377, 1.7968208081198471,  },
-         { { 0,1 }, 2.0000000000000000, 2.0790467262268066, 2.2486999654769901, 2.7890451822685014,  },
-         { { 0,2 }, 3.0000000000000000, 2.3673813343048096, 2.5602953386306773, 3.3724313031868260,  },
-         { { 0,3 }, 4.0000000000000000, 2.6885392665863037, 2.8587298488616932, 3.4947858723677401,  },
-         { { 2,0 }, 9.0000000000000000, 8.2817668914794922, 7.8675784397125232, 7.3065024327561421,  },
-         { { 2,1 }, 10.0000000000000000, 8.7958631515502930, 8.9461545658111579, 8.0947681375657314,  },
-         { { 2,2 }, 11.0000000000000000, 10.0157260894775391, 10.1858596420288077, 6.5219392279031272,  },
-         { { 2,3 }, 12.0000000000000000, 11.3744554519653320, 11.3822120094299297, 7.7491613766771659,  },
+         { { 0,0 }, 1.0000000000000000, 1.9575315713882446, 1.9754841327667239, 1.7968207042655990,  },
+         { { 0,1 }, 2.0000000000000000, 2.0790467262268066, 2.2486999964714043, 2.7890449770683099,  },
+         { { 0,2 }, 3.0000000000000000, 2.3673813343048096, 2.5602953529357908, 3.3724311925139956,  },
+         { { 0,3 }, 4.0000000000000000, 2.6885392665863037, 2.8587298583984371, 3.4947861829248077,  },
+         { { 2,0 }, 9.0000000000000000, 8.2817668914794922, 7.8675784587860091, 7.3065015118155578,  },
+         { { 2,1 }, 10.0000000000000000, 8.7958631515502930, 8.9461546421051050, 8.0947672055827944,  },
+         { { 2,2 }, 11.0000000000000000, 10.0157260894775391, 10.1858596801757777, 6.5219374586322374,  },
+         { { 2,3 }, 12.0000000000000000, 11.3744554519653320, 11.3822120666503910, 7.7491637309558428,  },
       }
   }
 },
 { 1950,
-  { 0.9236974593345043,
+  { 0.9236974621172686,
       {
          { { 0,0 }, 1.0000000000000000, 1.9532738924026489, 1.9987836647033690, 1.8905524119076562,  },
-         { { 0,1 }, 2.0000000000000000, 2.0194809436798096, 2.2403431534767142, 3.1881783872665141,  },
+         { { 0,1 }, 2.0000000000000000, 2.0194809436798096, 2.2403431510925280, 3.1881784917984626,  },
          { { 0,2 }, 3.0000000000000000, 2.2763950824737549, 2.5145437645912172, 3.4107583141290667,  },
          { { 0,3 }, 4.0000000000000000, 2.5708334445953369, 2.8077803802490222, 4.2687640086168406,  },
          { { 2,0 }, 9.0000000000000000, 8.2899208068847656, 7.9423309040069601, 6.9946252827158037,  },
-         { { 2,1 }, 10.0000000000000000, 8.5709114074707031, 8.8918395709991422, 11.8782285260349543,  },
+         { { 2,1 }, 10.0000000000000000, 8.5709114074707031, 8.8918395519256581, 11.8782293590648980,  },
          { { 2,2 }, 11.0000000000000000, 9.6612844467163086, 9.9821767044067400, 7.5514154634562853,  },
          { { 2,3 }, 12.0000000000000000, 10.9109144210815430, 11.1451905250549306, 8.9001136496122175,  },
       }
   }
 },
 { 2004,
-  { 0.2371818543060203,
+  { 0.2371814126285467,
       {
-         { { 0,0 }, 1.0000000000000000, 1.9618740081787109, 1.4931089878082273, 7.4984693201862722,  },
-         { { 0,1 }, 2.0000000000000000, 1.5820140838623047, 2.0782089996337874, 6.1185279721311012,  },
-         { { 0,2 }, 3.0000000000000000, 2.3384146690368652, 2.8072545909881588, 8.5678703065475883,  },
-         { { 0,3 }, 4.0000000000000000, 4.3314070701599121, 3.6240938615798943, 9.0850673685497334,  },
-         { { 2,0 }, 9.0000000000000000, 8.9051742553710938, 8.8595780372619632, 14.8792564376021854,  },
-         { { 2,1 }, 10.0000000000000000, 10.5367136001586914, 9.9617773437500006, 10.9655407208115516,  },
-         { { 2,2 }, 11.0000000000000000, 11.6340751647949219, 11.0331950378417929, 6.1197359087768683,  },
-         { { 2,3 }, 12.0000000000000000, 11.8261041641235352, 12.0055953025817868, 6.4745262386100029,  },
+         { { 0,0 }, 1.0000000000000000, 1.9618723392486572, 1.4931084036827089, 7.4984497968751302,  },
+         { { 0,1 }, 2.0000000000000000, 1.5820147991180420, 2.0782077980041507, 6.1185164280667861,  },
+         { { 0,2 }, 3.0000000000000000, 2.3384122848510742, 2.8072546887397776, 8.5678410099386664,  },
+         { { 0,3 }, 4.0000000000000000, 4.3314003944396973, 3.6240949296951306, 9.0850394030202288,  },
+         { { 2,0 }, 9.0000000000000000, 8.9051761627197266, 8.8595782852172889, 14.8792614514993300,  },
+         { { 2,1 }, 10.0000000000000000, 10.5367145538330078, 9.9617775154113737, 10.9655749933912166,  },
+         { { 2,2 }, 11.0000000000000000, 11.6340723037719727, 11.0331952476501449, 6.1197153848603500,  },
+         { { 2,3 }, 12.0000000000000000, 11.8260936737060547, 12.0055950736999488, 6.4745141575567722,  },
       }
   }
 },
 { 2056,
-  { 0.1671257232710754,
+  { 0.1671256522478188,
       {
-         { { 0,0 }, 1.0000000000000000, 0.9178731441497803, 1.2601818752288823, 9.3254404868444229,  },
-         { { 0,1 }, 2.0000000000000000, 2.5445919036865234, 2.1833934187889108, 8.0362827956192628,  },
-         { { 0,2 }, 3.0000000000000000, 3.4462718963623047, 2.9740832328796394, 4.7196468094209614,  },
-         { { 0,3 }, 4.0000000000000000, 3.0958552360534668, 3.6647080039978022, 7.1152917061645127,  },
-         { { 2,0 }, 9.0000000000000000, 8.9686450958251953, 8.9990673255920424, 12.8286318763011753,  },
-         { { 2,1 }, 10.0000000000000000, 10.5873422622680664, 9.9955418777465788, 13.4674621978837123,  },
-         { { 2,2 }, 11.0000000000000000, 11.9557962417602539, 10.9973862266540507, 8.3243153135150578,  },
-         { { 2,3 }, 12.0000000000000000, 12.2158651351928711, 11.9051299476623544, 8.0325597756167717,  },
+         { { 0,0 }, 1.0000000000000000, 0.9178752899169922, 1.2601818919181824, 9.3254544315589687,  },
+         { { 0,1 }, 2.0000000000000000, 2.5445938110351562, 2.1833934521675111, 8.0362977098177222,  },
+         { { 0,2 }, 3.0000000000000000, 3.4462723731994629, 2.9740829086303715, 4.7196397171121971,  },
+         { { 0,3 }, 4.0000000000000000, 3.0958557128906250, 3.6647083377838130, 7.1152742743735571,  },
+         { { 2,0 }, 9.0000000000000000, 8.9686479568481445, 8.9990676879882816, 12.8286100361055961,  },
+         { { 2,1 }, 10.0000000000000000, 10.5873441696166992, 9.9955416679382285, 13.4674682922709525,  },
+         { { 2,2 }, 11.0000000000000000, 11.9557991027832031, 10.9973864936828623, 8.3242962138378243,  },
+         { { 2,3 }, 12.0000000000000000, 12.2158708572387695, 11.9051299667358350, 8.0325574725978477,  },
       }
   }
 },
 { 2110,
-  { 0.1108907614299711,
+  { 0.1106237009022549,
       {
-         { { 0,0,0 }, 1.0000000000000000, 1.6508181095123291, 1.1857540571689607, 10.3192537440617844,  },
-         { { 0,0,1 }, 2.0000000000000000, 1.7593016624450684, 2.0690630912780765, 8.9599202904400084,  },
-         { { 0,0,2 }, 3.0000000000000000, 2.5202779769897461, 3.0741204833984384, 7.6030052972477495,  },
-         { { 0,0,3 }, 4.0000000000000000, 3.4980344772338867, 3.8180914402008046, 6.4751962756399779,  },
-         { { 0,2,0 }, 9.0000000000000000, 8.2359428405761719, 8.9993442535400376, 7.6302570275620356,  },
-         { { 0,2,1 }, 10.0000000000000000, 10.6420726776123047, 10.0271902084350604, 6.9498363678740089,  },
-         { { 0,2,2 }, 11.0000000000000000, 11.7252836227416992, 10.9766951942443871, 6.8113720210858490,  },
-         { { 0,2,3 }, 12.0000000000000000, 10.7765436172485352, 11.8613191223144572, 6.6677794545560563,  },
+         { { 0,0,0 }, 1.0000000000000000, 1.6440906524658203, 1.1851567292213443, 10.2710398691925811,  },
+         { { 0,0,1 }, 2.0000000000000000, 1.7669113874435425, 2.0694898319244386, 8.9619535921276832,  },
+         { { 0,0,2 }, 3.0000000000000000, 2.5228986740112305, 3.0749319505691526, 7.6397962444747112,  },
+         { { 0,0,3 }, 4.0000000000000000, 3.4439034461975098, 3.8190101146697999, 6.5182344088379978,  },
+         { { 0,2,0 }, 9.0000000000000000, 8.2730245590209961, 9.0010614585876478, 7.5693859936354508,  },
+         { { 0,2,1 }, 10.0000000000000000, 10.6750822067260742, 10.0292026901245137, 6.9854820592418925,  },
+         { { 0,2,2 }, 11.0000000000000000, 11.7356033325195312, 10.9774732398986821, 6.7526738340156811,  },
+         { { 0,2,3 }, 12.0000000000000000, 10.7976160049438477, 11.8619584846496586, 6.6643118161364212,  },
       }
   }
 },
@@ -447,30 +447,86 @@
   }
 },
 { 2222,
-  { 0.1368434282146375,
+  { 0.1350852520086578,
       {
-         { { 0,0,0 }, 1.0000000000000000, 0.9698737859725952, 1.0515938949584964, 5.7224190861505653,  },
-         { { 0,0,1 }, 2.0000000000000000, 2.5421736240386963, 2.1283959698677073, 6.1099716143982983,  },
-         { { 0,0,2 }, 3.0000000000000000, 2.9191896915435791, 3.1169437074661261, 7.7225418840618225,  },
-         { { 0,0,3 }, 4.0000000000000000, 3.9179561138153076, 4.0247748851776128, 8.3404391059566514,  },
-         { { 0,2,0 }, 9.0000000000000000, 9.2344198226928711, 9.1648818016052260, 6.2552782424704629,  },
-         { { 0,2,1 }, 10.0000000000000000, 10.3847579956054688, 10.0151001548767074, 5.9899334156955062,  },
-         { { 0,2,2 }, 11.0000000000000000, 10.7663116455078125, 10.8703854370117181, 5.5121465506745935,  },
-         { { 0,2,3 }, 12.0000000000000000, 11.6161031723022461, 11.7313776779174823, 8.9714738907747815,  },
+         { { 0,0,0 }, 1.0000000000000000, 0.9749839305877686, 1.0530754303932188, 5.7305841294262612,  },
+         { { 0,0,1 }, 2.0000000000000000, 2.5470092296600342, 2.1253612542152402, 6.1120575448524930,  },
+         { { 0,0,2 }, 3.0000000000000000, 2.9136004447937012, 3.1177719020843506, 7.7295429742056667,  },
+         { { 0,0,3 }, 4.0000000000000000, 3.9148137569427490, 4.0243645143508893, 8.3287832652863010,  },
+         { { 0,2,0 }, 9.0000000000000000, 9.2436513900756836, 9.1622636032104499, 6.2701680657811076,  },
+         { { 0,2,1 }, 10.0000000000000000, 10.3899660110473633, 10.0148015785217304, 5.9899044843843283,  },
+         { { 0,2,2 }, 11.0000000000000000, 10.7621059417724609, 10.8725191497802740, 5.5141849981678357,  },
+         { { 0,2,3 }, 12.0000000000000000, 11.6088485717773438, 11.7350698661804227, 9.0573309972439713,  },
       }
   }
 },
 { 2280,
-  { 0.0982344806299779,
-      {
-         { { 0,0,0 }, 1.0000000000000000, 1.4887170791625977, 1.0418097734451293, 6.1424458985601680,  },
-         { { 0,0,1 }, 2.0000000000000000, 2.6552660465240479, 2.0127118158340456, 6.0812652054627634,  },
-         { { 0,0,2 }, 3.0000000000000000, 3.7529222965240479, 3.1079650068283087, 10.2512636203537575,  },
-         { { 0,0,3 }, 4.0000000000000000, 3.7427687644958496, 4.1955086183547943, 7.1137631999300872,  },
-         { { 0,2,0 }, 9.0000000000000000, 8.4696817398071289, 9.0448040962219274, 10.3003372790467473,  },
-         { { 0,2,1 }, 10.0000000000000000, 9.5456771850585938, 10.0130723953247056, 7.6307563937789462,  },
-         { { 0,2,2 }, 11.0000000000000000, 10.6280117034912109, 10.9288606643676758, 4.3025806553541814,  },
-         { { 0,2,3 }, 12.0000000000000000, 12.0335521697998047, 11.8651990509033212, 9.0533524184992729,  },
+  { 0.0982418810848449,
+      {
+         { { 0,0,0 }, 1.0000000000000000, 1.5133266448974609, 1.0401766133308410, 6.1863076849599024,  },
+         { { 0,0,1 }, 2.0000000000000000, 2.6799437999725342, 2.0153145408630371, 6.1937949818230180,  },
+         { { 0,0,2 }, 3.0000000000000000, 3.7581598758697510, 3.1087406444549557, 10.2301882156895605,  },
+         { { 0,0,3 }, 4.0000000000000000, 3.7218036651611328, 4.1961236095428474, 7.1703981023452945,  },
+         { { 0,2,0 }, 9.0000000000000000, 8.5363082885742188, 9.0427972412109376, 10.1770460188497260,  },
+         { { 0,2,1 }, 10.0000000000000000, 9.5936422348022461, 10.0144954681396499, 7.5344469042465789,  },
+         { { 0,2,2 }, 11.0000000000000000, 10.5979471206665039, 10.9286193275451655, 4.3242100986979768,  },
+         { { 0,2,3 }, 12.0000000000000000, 11.8626384735107422, 11.8660704612731926, 8.9841036904385945,  },
+      }
+  }
+},
+{ 3110,
+  { 0.1396576675519974,
+      {
+         { { 0,0,0 }, 1.0000000000000000, 0.9539186954498291, 1.2061377489566807, 10.2634824899782231,  },
+         { { 0,0,1 }, 2.0000000000000000, 1.5444719791412354, 2.0584817075729376, 10.7833031736419596,  },
+         { { 0,0,2 }, 3.0000000000000000, 2.5496926307678223, 2.9215804028511050, 10.6080346167132920,  },
+         { { 0,0,3 }, 4.0000000000000000, 3.8145251274108887, 3.6886989259719853, 7.2329271444448935,  },
+         { { 0,2,0 }, 9.0000000000000000, 9.2888832092285156, 8.9534697341918950, 12.8813914489005352,  },
+         { { 0,2,1 }, 10.0000000000000000, 9.9875421524047852, 9.9492184638977044, 7.7675339305847091,  },
+         { { 0,2,2 }, 11.0000000000000000, 10.4851436614990234, 10.9573879432678183, 8.4812927987850166,  },
+         { { 0,2,3 }, 12.0000000000000000, 12.6147289276123047, 11.9775584793090815, 10.8800359864867708,  },
+      }
+  }
+},
+{ 3164,
+  { 7.7136243102707560,
+      {
+         { { 0,0,0 }, 1.0000000000000000, 0.0000000000000000, 0.0000000000000000, 0.0000000000000000,  },
+         { { 0,0,1 }, 2.0000000000000000, 0.0000000000000000, 0.0000000000000000, 0.0000000000000000,  },
+         { { 0,0,2 }, 3.0000000000000000, 0.0000000000000000, 0.0000000000000000, 0.0000000000000000,  },
+         { { 0,0,3 }, 4.0000000000000000, 0.0000000000000000, 0.0000000000000000, 0.0000000000000000,  },
+         { { 0,2,0 }, 9.0000000000000000, 0.0000000000000000, 0.0000000000000000, 0.0000000000000000,  },
+         { { 0,2,1 }, 10.0000000000000000, 0.0000000000000000, 0.0000000000000000, 0.0000000000000000,  },
+         { { 0,2,2 }, 11.0000000000000000, 0.0000000000000000, 0.0000000000000000, 0.0000000000000000,  },
+         { { 0,2,3 }, 12.0000000000000000, 0.0000000000000000, 0.0000000000000000, 0.0000000000000000,  },
+      }
+  }
+},
+{ 3222,
+  { 0.1591174930364994,
+      {
+         { { 0,0,0 }, 1.0000000000000000, -0.0245306491851807, 1.2616073822975160, 10.3207410473410608,  },
+         { { 0,0,1 }, 2.0000000000000000, 2.1343355178833008, 2.0132729077339184, 7.8500235758522257,  },
+         { { 0,0,2 }, 3.0000000000000000, 3.1575336456298828, 2.9393369078636171, 11.5560123486695883,  },
+         { { 0,0,3 }, 4.0000000000000000, 3.1740722656250000, 3.7473545885086059, 10.2529111469639886,  },
+         { { 0,2,0 }, 9.0000000000000000, 8.7834587097167969, 8.8753741931915275, 9.7959347953295914,  },
+         { { 0,2,1 }, 10.0000000000000000, 9.7061100006103516, 9.8882138442993170, 6.6409880701976993,  },
+         { { 0,2,2 }, 11.0000000000000000, 10.5633268356323242, 11.0780217552185043, 11.2294805432007827,  },
+         { { 0,2,3 }, 12.0000000000000000, 11.8812255859375000, 12.1797430801391595, 9.9668755080984646,  },
+      }
+  }
+},
+{ 3280,
+  { 0.1613694110556959,
+      {
+         { { 0,0,0 }, 1.0000000000000000, 1.1113494634628296, 1.2568684220314026, 11.0273412180666117,  },
+         { { 0,0,1 }, 2.0000000000000000, 2.5387315750122070, 2.1686098575592054, 7.6422910238286148,  },
+         { { 0,0,2 }, 3.0000000000000000, 2.7831864356994629, 2.9377107000350948, 8.6536595009210728,  },
+         { { 0,0,3 }, 4.0000000000000000, 3.5187547206878662, 3.6991042661666866, 11.7019679938586805,  },
+         { { 0,2,0 }, 9.0000000000000000, 9.8278493881225586, 8.8794181632995599, 14.8940952500220920,  },
+         { { 0,2,1 }, 10.0000000000000000, 9.9656696319580078, 9.9800671386718740, 7.2547198098902994,  },
+         { { 0,2,2 }, 11.0000000000000000, 11.2203922271728516, 11.0600409507751465, 11.1099800865963534,  },
+         { { 0,2,3 }, 12.0000000000000000, 11.7601718902587891, 12.0308157539367659, 10.0934861335983683,  },
       }
   }
 },
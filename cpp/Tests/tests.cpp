@@ -1,9 +1,14 @@
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <set>
 #include <sstream>
+#include <thread>
 #include <vector>
 #include <limits>
 
@@ -12,16 +17,28 @@
 #include <catch2/catch_approx.hpp>
 
 #include <SmurffCpp/result.h>
+#include <SmurffCpp/Predict/PredictSession.h>
+#include <SmurffCpp/Sessions/TrainSession.h>
 
 #include <SmurffCpp/Utils/TruncNorm.h>
 #include <SmurffCpp/Utils/InvNormCdf.h>
 #include <SmurffCpp/Utils/Distribution.h>
 #include <SmurffCpp/Utils/counters.h>
 #include <SmurffCpp/Utils/MatrixUtils.h>
+#include <SmurffCpp/Utils/FixedKernels.hpp>
+#include <SmurffCpp/Utils/PackedSymmetric.hpp>
+#include <SmurffCpp/Utils/NoMalloc.h>
+#include <SmurffCpp/Utils/MappedFile.h>
+#include <SmurffCpp/Utils/MatrixIO.h>
+#include <SmurffCpp/Utils/GenericIO.h>
+#include <SmurffCpp/Utils/AsyncWriter.hpp>
+#include <SmurffCpp/Utils/Prefetcher.hpp>
+#include <SmurffCpp/Utils/SampleCodec.h>
 
 #include <SmurffCpp/Configs/DataConfig.h>
 
 #include <SmurffCpp/Priors/ILatentPrior.h>
+#include <SmurffCpp/Priors/NormalPrior.h>
 #include <SmurffCpp/Priors/MacauPrior.h>
 #include <SmurffCpp/Priors/MacauOnePrior.h>
 
@@ -32,6 +49,8 @@
 #include <SmurffCpp/DataMatrices/FullMatrixData.hpp>
 #include <SmurffCpp/DataMatrices/SparseMatrixData.h>
 #include <SmurffCpp/DataMatrices/DenseMatrixData.h>
+#include <SmurffCpp/DataTensors/TensorData.h>
+#include <SmurffCpp/DataTensors/DenseTensorData.h>
 
 #include <SmurffCpp/SideInfo/DenseSideInfo.h>
 
@@ -161,6 +180,936 @@ TEST_CASE( "ScarceMatrixData/var_total", "Test if variance of Scarce Matrix is c
   REQUIRE(data->var_total() == Catch::Approx(0.25));
 }
 
+TEST_CASE( "ScarceMatrixData/getMuLambda", "Test if gather kernel gives the same mean and precision as rank-1 updates") {
+  std::vector<std::uint32_t> rows, cols;
+  std::vector<double>        vals;
+  for (std::uint32_t c = 0; c < 300; ++c)
+  {
+    rows.push_back(0); cols.push_back(c); vals.push_back(c % 7 - 3.);
+    if (c % 3 == 0) { rows.push_back(1); cols.push_back(c); vals.push_back(c % 5 + 1.); }
+  }
+
+  const SparseMatrix S = matrix_utils::sparse_to_eigen(SparseTensor( {2, 300}, { rows, cols }, vals));
+  std::shared_ptr<ScarceMatrixData> data(new ScarceMatrixData(S));
+  data->setNoiseModel(NoiseFactory::create_noise_model(fixed_ncfg));
+  data->init();
+
+  // 4: dynamic kernels, 8: fixed-size kernels
+  for (int nl : {4, 8})
+  {
+    init_bmrng(1234);
+    Model model;
+    model.init(nl, PVec<>({2, 300}), ModelInitTypes::random, false);
+
+    for (std::uint32_t mode = 0; mode < 2; ++mode)
+    {
+      for (int n : {0, 1, 3})
+      {
+        if (n >= model.U(mode).rows()) continue;
+
+        Vector rr_basic = Vector::Zero(nl), rr_gather = Vector::Zero(nl);
+        Matrix MM_basic = Matrix::Zero(nl, nl), MM_gather = Matrix::Zero(nl, nl);
+
+        data->setGatherKernel(false);
+        data->getMuLambda(model, mode, n, rr_basic, MM_basic);
+        data->setGatherKernel(true);
+        data->getMuLambda(model, mode, n, rr_gather, MM_gather);
+
+        REQUIRE(rr_gather.isApprox(rr_basic));
+        REQUIRE(MM_gather.isApprox(MM_basic));
+      }
+    }
+  }
+}
+
+TEST_CASE( "ScarceMatrixData/allocations", "Test if getMuLambda and getMuLowRank do not allocate once the workspaces are warm") {
+  std::vector<std::uint32_t> rows, cols;
+  std::vector<double>        vals;
+  for (std::uint32_t r = 0; r < 200; ++r)
+    for (std::uint32_t j = 0; j < 5; ++j)
+    {
+      rows.push_back(r); cols.push_back((r * 7 + j * 13) % 50); vals.push_back((r + j) % 5 - 2.);
+    }
+
+  const SparseMatrix S = matrix_utils::sparse_to_eigen(SparseTensor( {200, 50}, { rows, cols }, vals));
+  std::shared_ptr<ScarceMatrixData> data(new ScarceMatrixData(S));
+  data->setNoiseModel(NoiseFactory::create_noise_model(fixed_ncfg));
+  data->init();
+
+  init_bmrng(1234);
+  Model model;
+  model.init(8, PVec<>({200, 50}), ModelInitTypes::random, false);
+
+  Vector rr = Vector::Zero(8);
+  Matrix MM = Matrix::Zero(8, 8);
+  Matrix Vd(8, 8);
+  int rank = 0;
+
+  // warm up the workspaces of this thread
+  data->getMuLambda(model, 0, 0, rr, MM);
+
+  {
+    NoMalloc no_malloc;
+    for (int n = 0; n < 200; ++n)
+    {
+      data->getMuLambda(model, 0, n, rr, MM);
+      REQUIRE(data->getMuLowRank(model, 0, n, 8, rr, Vd, rank));
+      REQUIRE(rank == 5);
+    }
+  }
+}
+
+TEST_CASE( "NormalPrior/allocations", "Test if sample_latent does not allocate once the workspaces are warm") {
+  // rows 0..299: 2 or 9 observations, below and above num_latent; no row holds
+  // more than 1% of the data, so getMuLambda stays on the sequential path
+  std::vector<std::uint32_t> rows, cols;
+  std::vector<double>        vals;
+  for (std::uint32_t r = 0; r < 300; ++r)
+    for (std::uint32_t j = 0; j < (r % 2 ? 9u : 2u); ++j)
+    {
+      rows.push_back(r); cols.push_back((r * 7 + j * 13) % 400); vals.push_back((r + j) % 5 - 2.);
+    }
+
+  Config config;
+  config.setPriorTypes({PriorTypes::normal, PriorTypes::normal});
+  config.setNumLatent(8);
+  config.setRandomSeed(1234);
+  config.setVerbose(0);
+  config.getTrain().setData(matrix_utils::sparse_to_eigen(SparseTensor( {300, 400}, { rows, cols }, vals)), true);
+  config.getTrain().setNoiseConfig(fixed_ncfg);
+
+  TrainSession session(config);
+  session.init();
+
+  NormalPrior prior(session, 0);
+  prior.init();
+
+  // factors Lambda and warms up the workspaces of all threads
+  prior.sample_latents();
+
+  {
+    NoMalloc no_malloc;
+    for (int n = 0; n < 300; ++n)
+      prior.sample_latent(n);
+  }
+
+  REQUIRE(session.model().U(0).allFinite());
+}
+
+TEST_CASE( "ScarceMatrixData/getSampleOrder", "Test if rows are scheduled by decreasing number of observations") {
+  std::vector<std::uint32_t> rows = {0, 1, 1, 1, 2, 2, 3, 3, 3, 3};
+  std::vector<std::uint32_t> cols = {0, 0, 1, 2, 0, 1, 0, 1, 2, 3};
+  std::vector<double>        vals(rows.size(), 1.);
+
+  const SparseMatrix S = matrix_utils::sparse_to_eigen(SparseTensor( {4, 4}, { rows, cols }, vals));
+  std::shared_ptr<ScarceMatrixData> data(new ScarceMatrixData(S));
+  data->setNoiseModel(NoiseFactory::create_noise_model(fixed_ncfg));
+  data->init();
+  REQUIRE(data->getSampleOrder(0).empty());
+
+  data->setDegreeSchedule(true);
+  data->init();
+  REQUIRE(data->getSampleOrder(0) == std::vector<int>({3, 1, 2, 0}));
+  REQUIRE(data->getSampleOrder(1) == std::vector<int>({0, 1, 2, 3}));
+  REQUIRE(data->row_nnz(1, 3) == 1);
+}
+
+TEST_CASE( "ScarceMatrixData/transposed", "Test if the columns share the values of the rows, or use a copy when asked") {
+  std::vector<std::uint32_t> rows = {0, 0, 1, 2, 2, 2, 3};
+  std::vector<std::uint32_t> cols = {1, 3, 0, 0, 1, 3, 2};
+  std::vector<double>        vals = {1., 2., 3., 4., 5., 6., 7.};
+
+  const SparseMatrix S = matrix_utils::sparse_to_eigen(SparseTensor( {4, 4}, { rows, cols }, vals));
+  const Matrix Yt = Matrix(S).transpose();
+
+  init_bmrng(1234);
+  Model model;
+  model.init(3, PVec<>({4, 4}), ModelInitTypes::random, false);
+
+  Vector rr_shared = Vector::Zero(3), rr_copy = Vector::Zero(3);
+  Matrix MM_shared = Matrix::Zero(3, 3), MM_copy = Matrix::Zero(3, 3);
+
+  for (bool transposed_values : {false, true})
+  {
+    std::shared_ptr<ScarceMatrixData> data(new ScarceMatrixData(S));
+    data->setNoiseModel(NoiseFactory::create_noise_model(fixed_ncfg));
+    data->setTransposedValues(transposed_values);
+    data->init();
+
+    const auto Y = data->Y(1);
+    REQUIRE(Y.rows() == 4);
+    REQUIRE(Y.nonZeros() == 7);
+    for (int c = 0; c < 4; ++c)
+    {
+      int n = 0;
+      for (SparseModeView::InnerIterator it(Y, c); it; ++it, ++n)
+        REQUIRE(it.value() == Yt(c, it.col()));
+      REQUIRE(n == (Yt.row(c).array() != 0).count());
+      REQUIRE(data->row_nnz(1, c) == (std::uint64_t)n);
+    }
+
+    for (int c = 0; c < 4; ++c)
+      data->getMuLambda(model, 1, c, transposed_values ? rr_copy : rr_shared, transposed_values ? MM_copy : MM_shared);
+  }
+
+  REQUIRE(rr_copy.isApprox(rr_shared));
+  REQUIRE(MM_copy.isApprox(MM_shared));
+}
+
+TEST_CASE( "ScarceMatrixData/mapped", "Test if data mapped from a file gives the same results as data in memory") {
+  typedef SparseMatrix::StorageIndex Index;
+
+  std::vector<std::uint32_t> rows = {0, 0, 1, 2, 2, 2, 3};
+  std::vector<std::uint32_t> cols = {1, 3, 0, 0, 1, 3, 2};
+  std::vector<double>        vals = {1., 2., 3., 4., 5., 6., 7.};
+
+  const SparseMatrix S = matrix_utils::sparse_to_eigen(SparseTensor( {4, 4}, { rows, cols }, vals));
+  std::vector<Index> t_outer, t_inner, t_perm;
+  matrix_utils::transposed_index(SparseMatrixMap(4, 4, 7, S.outerIndexPtr(), S.innerIndexPtr(), S.valuePtr()), t_outer, t_inner, t_perm);
+
+  // values first: all offsets stay aligned
+  const char *fname = "ScarceMatrixData_mapped.bin";
+  std::uint64_t offsets[6];
+  {
+    std::ofstream os(fname, std::ios::binary);
+    auto put = [&os](const void *data, std::size_t bytes) -> std::uint64_t {
+      std::uint64_t offset = os.tellp();
+      os.write(static_cast<const char *>(data), bytes);
+      return offset;
+    };
+    offsets[0] = put(S.valuePtr(), 7 * sizeof(float_type));
+    offsets[1] = put(S.outerIndexPtr(), 5 * sizeof(Index));
+    offsets[2] = put(S.innerIndexPtr(), 7 * sizeof(Index));
+    offsets[3] = put(t_outer.data(), 5 * sizeof(Index));
+    offsets[4] = put(t_inner.data(), 7 * sizeof(Index));
+    offsets[5] = put(t_perm.data(), 7 * sizeof(Index));
+  }
+
+  MappedSparseMatrix M;
+  M.file = std::make_shared<MappedFile>(fname);
+  M.rows = 4;
+  M.cols = 4;
+  M.nnz = 7;
+  M.values = M.file->data<float_type>(offsets[0], 7);
+  M.outer = M.file->data<Index>(offsets[1], 5);
+  M.inner = M.file->data<Index>(offsets[2], 7);
+  M.t_outer = M.file->data<Index>(offsets[3], 5);
+  M.t_inner = M.file->data<Index>(offsets[4], 7);
+  M.t_perm = M.file->data<Index>(offsets[5], 7);
+  REQUIRE_THROWS(M.file->data<float_type>(offsets[5], 100));
+
+  std::shared_ptr<ScarceMatrixData> in_memory(new ScarceMatrixData(S));
+  std::shared_ptr<ScarceMatrixData> mapped(new ScarceMatrixData(M));
+  for (auto data : {in_memory, mapped})
+  {
+    data->setNoiseModel(NoiseFactory::create_noise_model(fixed_ncfg));
+    data->init();
+  }
+  REQUIRE(mapped->nnz() == 7);
+  REQUIRE(mapped->sum() == Catch::Approx(28.));
+
+  init_bmrng(1234);
+  Model model;
+  model.init(3, PVec<>({4, 4}), ModelInitTypes::random, false);
+
+  for (std::uint32_t mode = 0; mode < 2; ++mode)
+  {
+    for (int n = 0; n < 4; ++n)
+    {
+      Vector rr_memory = Vector::Zero(3), rr_mapped = Vector::Zero(3);
+      Matrix MM_memory = Matrix::Zero(3, 3), MM_mapped = Matrix::Zero(3, 3);
+      in_memory->getMuLambda(model, mode, n, rr_memory, MM_memory);
+      mapped->getMuLambda(model, mode, n, rr_mapped, MM_mapped);
+      REQUIRE(rr_mapped.isApprox(rr_memory));
+      REQUIRE(MM_mapped.isApprox(MM_memory));
+    }
+  }
+
+  REQUIRE(mapped->sumsq(model) == Catch::Approx(in_memory->sumsq(model)));
+
+  mapped.reset();
+  M = MappedSparseMatrix();
+  std::remove(fname);
+}
+
+TEST_CASE( "matrix_io/read_matrix", "Test if all matrix file formats give the same matrix") {
+  // 3 x 4, one entry given twice in the text files
+  std::vector<std::int32_t> rows = {2, 0, 1, 0, 2};
+  std::vector<std::int32_t> cols = {3, 1, 0, 0, 1};
+  std::vector<double>       vals = {5., 2., 3., 1., 4.};
+
+  Matrix dense = Matrix::Zero(3, 4);
+  for (std::size_t i = 0; i < rows.size(); ++i)
+    dense(rows[i], cols[i]) = vals[i];
+
+  auto write = [](const char *fname, const std::string &text) {
+    std::ofstream(fname) << text;
+  };
+
+  auto write_binary = [&](const char *fname, bool with_values) {
+    std::ofstream os(fname, std::ios::binary);
+    std::int64_t header[3] = {3, 4, (std::int64_t)rows.size()};
+    os.write(reinterpret_cast<const char *>(header), sizeof(header));
+    for (auto r : rows) { std::int32_t v = r + 1; os.write(reinterpret_cast<const char *>(&v), sizeof(v)); }
+    for (auto c : cols) { std::int32_t v = c + 1; os.write(reinterpret_cast<const char *>(&v), sizeof(v)); }
+    if (with_values)
+      os.write(reinterpret_cast<const char *>(vals.data()), vals.size() * sizeof(double));
+  };
+
+  write_binary("matrix_io.sdm", true);
+  write_binary("matrix_io.sbm", false);
+  {
+    std::ofstream os("matrix_io.ddm", std::ios::binary);
+    std::int64_t header[2] = {3, 4};
+    os.write(reinterpret_cast<const char *>(header), sizeof(header));
+    for (int j = 0; j < 4; ++j)
+      for (int i = 0; i < 3; ++i)
+      {
+        double v = dense(i, j);
+        os.write(reinterpret_cast<const char *>(&v), sizeof(v));
+      }
+  }
+  write("matrix_io.mtx",
+        "%%MatrixMarket matrix coordinate real general\n"
+        "% comment\n"
+        "3 4 6\n"
+        "3 4 5.0\n1 2 0.5\n2 1 3\n1 1 1e0\n3 2 4\n1 2 1.5\n");
+  write("matrix_io_array.mm",
+        "%%MatrixMarket matrix array real general\n"
+        "3 4\n"
+        "1\n3\n0\n2\n0\n4\n0\n0\n0\n0\n0\n5\n");
+  write("matrix_io.csv",
+        "3\n4\n"
+        "1,2,0,0\n"
+        "3,0,0,0\n\n"
+        "0,4,0,5\n");
+  write("matrix_io_triplets.csv",
+        "row,col,value\r\n"
+        "0,1,2\r\n2,3,5\r\n1,0,3\r\n0,0,1\r\n2,1,4\r\n");
+
+  std::vector<std::string> sparse_files = {"matrix_io.sdm", "matrix_io.mtx", "matrix_io_triplets.csv"};
+  std::vector<std::string> dense_files = {"matrix_io.ddm", "matrix_io_array.mm", "matrix_io.csv"};
+
+  for (const auto &fname : sparse_files)
+  {
+    DataConfig dc;
+    generic_io::read_data_config(fname, true, dc);
+    REQUIRE(!dc.isDense());
+    REQUIRE(dc.isScarce());
+    REQUIRE(dc.getFilename() == fname);
+
+    const SparseMatrix &Y = static_cast<const DataConfig &>(dc).getSparseMatrixData();
+    REQUIRE(Y.isCompressed());
+    REQUIRE(Y.nonZeros() == 5);
+    REQUIRE(matrix_utils::equals(Matrix(Y), dense));
+    for (int k = 0; k < Y.outerSize(); ++k)
+      REQUIRE(std::is_sorted(Y.innerIndexPtr() + Y.outerIndexPtr()[k], Y.innerIndexPtr() + Y.outerIndexPtr()[k + 1]));
+  }
+
+  for (const auto &fname : dense_files)
+  {
+    DataConfig dc;
+    generic_io::read_data_config(fname, false, dc);
+    REQUIRE(dc.isDense());
+    REQUIRE(matrix_utils::equals(static_cast<const DataConfig &>(dc).getDenseMatrixData(), dense));
+  }
+
+  // pattern only: all values are 1
+  const SparseMatrix pattern = matrix_io::read_sparse_binary_matrix("matrix_io.sbm");
+  REQUIRE(pattern.nonZeros() == 5);
+  REQUIRE(matrix_utils::equals(Matrix(pattern), Matrix((dense.array() != 0).cast<float_type>())));
+
+  // out of range entry
+  write("matrix_io_bad.mtx", "%%MatrixMarket matrix coordinate real general\n2 2 1\n3 1 1.0\n");
+  DataConfig bad;
+  REQUIRE_THROWS(generic_io::read_data_config("matrix_io_bad.mtx", true, bad));
+  REQUIRE_THROWS(generic_io::read_data_config("matrix_io_missing.mtx", true, bad));
+
+  // truncated: fewer entries than on the size line
+  write("matrix_io_truncated.mtx", "%%MatrixMarket matrix coordinate real general\n3 4 3\n1 1 1.0\n2 1 3.0\n");
+  REQUIRE_THROWS(generic_io::read_data_config("matrix_io_truncated.mtx", true, bad));
+
+  // triplets do not reach the last row and col: the size comes from the hints
+  write("matrix_io_small.csv", "0,1,2\n1,0,3\n");
+  DataConfig small;
+  generic_io::read_data_config("matrix_io_small.csv", true, small);
+  REQUIRE(small.getDims() == std::vector<std::uint64_t>({2, 2}));
+  generic_io::read_data_config("matrix_io_small.csv", true, small, true, std::string(), 3, 4);
+  REQUIRE(small.getDims() == std::vector<std::uint64_t>({3, 4}));
+  generic_io::read_data_config("matrix_io_small.csv", true, small, true, std::string(), 3);
+  REQUIRE(small.getDims() == std::vector<std::uint64_t>({3, 2}));
+  REQUIRE_THROWS(generic_io::read_data_config("matrix_io_small.csv", true, small, true, std::string(), 1, 4));
+
+  for (const auto &fname : sparse_files) std::remove(fname.c_str());
+  for (const auto &fname : dense_files) std::remove(fname.c_str());
+  std::remove("matrix_io.sbm");
+  std::remove("matrix_io_bad.mtx");
+  std::remove("matrix_io_truncated.mtx");
+  std::remove("matrix_io_small.csv");
+}
+
+TEST_CASE( "matrix_io/chunks", "Test if a file parsed in many chunks gives the same matrix as setFromTriplets") {
+  const int nrow = 500, ncol = 300;
+  const char *fname = "matrix_io_chunks.mtx";
+
+  std::vector<Eigen::Triplet<float_type>> triplets;
+  std::stringstream body;
+  std::uint32_t state = 12345;
+  for (int i = 0; i < 40000; ++i)
+  {
+    state = state * 1664525u + 1013904223u;
+    const int r = (state >> 8) % nrow;
+    state = state * 1664525u + 1013904223u;
+    const int c = (state >> 8) % ncol;
+    const int v = 1 + i % 9;
+    triplets.emplace_back(r, c, v);
+    body << r + 1 << " " << c + 1 << " " << v << "\n";
+  }
+
+  std::ofstream(fname) << "%%MatrixMarket matrix coordinate integer general\n"
+                       << nrow << " " << ncol << " " << triplets.size() << "\n"
+                       << body.str();
+
+  SparseMatrix expected(nrow, ncol);
+  expected.setFromTriplets(triplets.begin(), triplets.end());
+
+  DataConfig dc;
+  generic_io::read_data_config(fname, true, dc);
+  const SparseMatrix &Y = static_cast<const DataConfig &>(dc).getSparseMatrixData();
+  REQUIRE(Y.nonZeros() == expected.nonZeros());
+  REQUIRE(matrix_utils::equals(Matrix(Y), Matrix(expected)));
+
+  std::remove(fname);
+}
+
+TEST_CASE( "generic_io/file_hash", "Test if data read from a file records its content hash and checks it when asked") {
+  const char *fname = "generic_io_hash.mtx";
+  std::ofstream(fname) << "%%MatrixMarket matrix coordinate real general\n2 2 2\n1 1 1.0\n2 2 2.0\n";
+
+  DataConfig dc;
+  generic_io::read_data_config(fname, true, dc);
+  const std::string hash = dc.getFileHash();
+  REQUIRE(hash.size() == 16);
+  REQUIRE(generic_io::file_hash(fname) == hash);
+
+  // not hashed unless asked
+  DataConfig unhashed;
+  generic_io::read_data_config(fname, true, unhashed, false);
+  REQUIRE(unhashed.getFileHash().empty());
+
+  // an expected hash is always checked
+  DataConfig same;
+  REQUIRE_NOTHROW(generic_io::read_data_config(fname, true, same, false, hash));
+  REQUIRE(same.getFileHash() == hash);
+
+  // one value changed
+  std::ofstream(fname) << "%%MatrixMarket matrix coordinate real general\n2 2 2\n1 1 1.0\n2 2 3.0\n";
+  REQUIRE(generic_io::file_hash(fname) != hash);
+  DataConfig changed;
+  REQUIRE_THROWS(generic_io::read_data_config(fname, true, changed, false, hash));
+
+  // other data is no longer the content of the file
+  dc.setData(SparseMatrix(2, 2));
+  REQUIRE(dc.getFileHash().empty());
+
+  std::remove(fname);
+}
+
+TEST_CASE( "AsyncWriter/order", "Test if snapshots are written in order from a fixed set of buffers, and write errors reach the caller") {
+  std::vector<int> written;
+  std::set<const int *> buffers;
+
+  {
+    AsyncWriter<int> writer(2, [&](const int &v) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+      written.push_back(v);
+      buffers.insert(&v);
+    });
+
+    for (int i = 0; i < 6; ++i)
+    {
+      writer.acquire() = i;
+      writer.push();
+    }
+    writer.wait();
+    REQUIRE(written == std::vector<int>({0, 1, 2, 3, 4, 5}));
+    REQUIRE(buffers.size() <= 2);
+
+    // pushed but not waited for: written by the destructor
+    writer.acquire() = 6;
+    writer.push();
+  }
+  REQUIRE(written.size() == 7);
+
+  AsyncWriter<int> failing(2, [](const int &v) {
+    if (v == 1)
+      throw std::runtime_error("write failed");
+  });
+  for (int i = 0; i < 2; ++i)
+  {
+    failing.acquire() = i;
+    failing.push();
+  }
+  REQUIRE_THROWS(failing.wait());
+  REQUIRE_THROWS(failing.acquire());
+}
+
+TEST_CASE( "Prefetcher/order", "Test if items are returned in order from a fixed set of buffers, and load errors reach the caller") {
+  std::set<const int *> buffers;
+  std::vector<int> returned;
+
+  {
+    Prefetcher<int> loader(2, 7, [](std::size_t i, int &v) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+      v = static_cast<int>(i) * 10;
+    });
+
+    for (std::size_t i = 0; i < loader.count(); ++i)
+    {
+      const int &v = loader.next();
+      buffers.insert(&v);
+      returned.push_back(v);
+    }
+    REQUIRE_THROWS(loader.next());
+  }
+  REQUIRE(returned == std::vector<int>({0, 10, 20, 30, 40, 50, 60}));
+  REQUIRE(buffers.size() == 2);
+
+  Prefetcher<int> failing(2, 5, [](std::size_t i, int &v) {
+    if (i == 3)
+      throw std::runtime_error("load failed");
+    v = static_cast<int>(i);
+  });
+  for (int i = 0; i < 3; ++i)
+    REQUIRE(failing.next() == i);
+  REQUIRE_THROWS(failing.next());
+
+  // destroyed before all items are returned
+  Prefetcher<int> abandoned(2, 100, [](std::size_t i, int &v) { v = static_cast<int>(i); });
+  REQUIRE(abandoned.next() == 0);
+}
+
+TEST_CASE( "sample_codec/encode", "Test if float16 and uint8 encoded matrices decode within their recorded error") {
+  using namespace sample_codec;
+
+  // exact float16 values, including subnormals, and rounding to nearest even
+  REQUIRE(to_half(1.0f) == 0x3c00);
+  REQUIRE(to_half(-2.0f) == 0xc000);
+  REQUIRE(to_half(65504.0f) == 0x7bff);
+  REQUIRE(to_half(65520.0f) == 0x7c00);
+  REQUIRE(to_half(std::ldexp(1.0f, -24)) == 0x0001);
+  REQUIRE(to_half(std::ldexp(1.0f, -25)) == 0x0000);
+  REQUIRE(to_half(1.0f + std::ldexp(1.0f, -11)) == 0x3c00);
+  REQUIRE(to_half(1.0f + 3 * std::ldexp(1.0f, -11)) == 0x3c02);
+  for (std::uint32_t h = 0; h < 0x7c00; ++h)
+  {
+    REQUIRE(to_half(from_half(h)) == h);
+    REQUIRE(to_half(from_half(h | 0x8000)) == (h | 0x8000));
+  }
+
+  Matrix M(50, 4);
+  for (int i = 0; i < M.rows(); ++i)
+    for (int j = 0; j < M.cols(); ++j)
+      M(i, j) = std::sin(0.37 * i + j) * (j + 1) - j;
+  M.col(3).setConstant(2.5);
+
+  Matrix D(M.rows(), M.cols());
+
+  std::vector<std::uint16_t> half;
+  double max_error;
+  REQUIRE(encode_float16(M, half, max_error));
+  decode_float16(half, D);
+  REQUIRE((D - M).cwiseAbs().maxCoeff() == Catch::Approx(max_error).margin(1e-12));
+  REQUIRE((D - M).cwiseAbs().maxCoeff() <= M.cwiseAbs().maxCoeff() * std::ldexp(1.0, -11));
+
+  Matrix large = M;
+  large(7, 1) = 1e5;
+  REQUIRE_FALSE(encode_float16(large, half, max_error));
+  REQUIRE(half.empty());
+
+  std::vector<std::uint8_t> bytes;
+  std::vector<double> scale, offset;
+  encode_uint8(M, bytes, scale, offset, max_error);
+  REQUIRE(bytes.size() == 200);
+  REQUIRE(scale[3] == 0.0);
+  REQUIRE(offset[3] == 2.5);
+  decode_uint8(bytes, scale, offset, D);
+  REQUIRE((D - M).cwiseAbs().maxCoeff() == Catch::Approx(max_error).margin(1e-12));
+  for (int j = 0; j < M.cols(); ++j)
+  {
+    REQUIRE(D.col(j).minCoeff() == Catch::Approx(M.col(j).minCoeff()));
+    REQUIRE(D.col(j).maxCoeff() == Catch::Approx(M.col(j).maxCoeff()));
+    REQUIRE((D.col(j) - M.col(j)).cwiseAbs().maxCoeff() <= scale[j] / 2 + 1e-12);
+  }
+}
+
+TEST_CASE( "DenseTensorData/getMuLambda", "Test if unfolding times Khatri-Rao product gives the same mean and precision as per-element updates") {
+  std::vector<std::uint64_t> dims = {3, 4, 5};
+  std::vector<double> vals(3 * 4 * 5);
+  for (std::size_t i = 0; i < vals.size(); ++i)
+    vals[i] = (i % 7) - 3.;
+  const DenseTensor Y(dims, vals);
+
+  std::shared_ptr<Data> dense(new DenseTensorData(Y));
+  std::shared_ptr<Data> coords(new TensorData(Y));
+  for (auto data : {dense, coords})
+  {
+    data->setNoiseModel(NoiseFactory::create_noise_model(fixed_ncfg));
+    data->init();
+  }
+
+  init_bmrng(1234);
+  Model model;
+  model.init(4, PVec<>({3, 4, 5}), ModelInitTypes::random, false);
+
+  REQUIRE(dense->sum() == Catch::Approx(coords->sum()));
+  REQUIRE(dense->sumsq(model) == Catch::Approx(coords->sumsq(model)));
+
+  for (std::uint32_t mode = 0; mode < 3; ++mode)
+  {
+    dense->update_pnm(model, mode);
+    coords->update_pnm(model, mode);
+    REQUIRE(dense->hasSharedPrecision(mode));
+
+    for (int d = 0; d < dense->dim(mode); ++d)
+    {
+      Vector rr_dense = Vector::Zero(4), rr_coords = Vector::Zero(4);
+      Matrix MM_dense = Matrix::Zero(4, 4), MM_coords = Matrix::Zero(4, 4);
+      dense->getMuLambda(model, mode, d, rr_dense, MM_dense);
+      coords->getMuLambda(model, mode, d, rr_coords, MM_coords);
+
+      REQUIRE(rr_dense.isApprox(rr_coords));
+      REQUIRE(MM_dense.isApprox(MM_coords));
+    }
+  }
+}
+
+TEST_CASE( "TensorData/threads", "Test if TensorData can sample with more threads than it was constructed with") {
+  std::vector<std::uint64_t> dims = {6, 4, 5};
+  std::vector<double> vals(6 * 4 * 5);
+  for (std::size_t i = 0; i < vals.size(); ++i)
+    vals[i] = (i % 7) - 3.;
+
+  const int nthreads = threads::get_max_threads();
+  threads::init(0, 1);
+  std::shared_ptr<Data> data(new TensorData(DenseTensor(dims, vals)));
+  data->setNoiseModel(NoiseFactory::create_noise_model(fixed_ncfg));
+
+  threads::init(0, 4);
+  data->init();
+
+  init_bmrng(1234);
+  Model model;
+  model.init(4, PVec<>({6, 4, 5}), ModelInitTypes::random, false);
+
+  std::vector<Vector> rr(6, Vector::Zero(4));
+  std::vector<Matrix> MM(6, Matrix::Zero(4, 4));
+  #pragma omp parallel for num_threads(4)
+  for (int d = 0; d < 6; ++d)
+    data->getMuLambda(model, 0, d, rr[d], MM[d]);
+
+  threads::init(0, nthreads);
+
+  for (int d = 0; d < 6; ++d)
+  {
+    Vector rr_seq = Vector::Zero(4);
+    Matrix MM_seq = Matrix::Zero(4, 4);
+    data->getMuLambda(model, 0, d, rr_seq, MM_seq);
+    REQUIRE(rr[d].isApprox(rr_seq));
+    REQUIRE(MM[d].isApprox(MM_seq));
+  }
+}
+
+TEST_CASE( "kernels/sample_mvnormal", "Test if fixed-size kernels give the same sample as the dynamic ones") {
+  init_bmrng(1234);
+  Matrix A = Matrix::Random(8, 8);
+  const Matrix MM = A * A.transpose() + 8 * Matrix::Identity(8, 8);
+  const Vector rr = Vector::Random(8);
+
+  Matrix MM_fixed = MM, MM_dynamic = MM;
+  Vector rr_fixed = rr, rr_dynamic = rr;
+
+  init_bmrng(1234);
+  kernels::sample_mvnormal<8>(MM_fixed, rr_fixed);
+  init_bmrng(1234);
+  kernels::sample_mvnormal<Eigen::Dynamic>(MM_dynamic, rr_dynamic);
+
+  REQUIRE(rr_fixed.isApprox(rr_dynamic));
+  REQUIRE(kernels::dot<8>(rr, rr_fixed) == Catch::Approx(rr.dot(rr_dynamic)));
+}
+
+TEST_CASE( "Model/updateAggr", "Test if packed posterior aggregates hold the sum of outer products") {
+  init_bmrng(1234);
+  Model model;
+  model.init(5, PVec<>({3, 4}), ModelInitTypes::random, false, true);
+
+  REQUIRE(model.getAggrDot(0).cols() == packed::size(5));
+
+  Matrix expected = Matrix::Zero(5, 5);
+  for (int s = 0; s < 3; ++s)
+  {
+    model.U(0) = Matrix::NullaryExpr(3, 5, RandNormalGenerator());
+    model.updateAggr(0, 1);
+    expected += model.U(0).row(1).transpose() * model.U(0).row(1);
+  }
+
+  Matrix actual;
+  packed::unpack(actual, model.getAggrDot(0).row(1), 5);
+  REQUIRE(actual.isApprox(expected, approx_epsilon<aggr_type>()));
+  REQUIRE(packed::unpack(model.getAggrDot(0), 0, 5).isZero());
+
+  AggrMatrix repacked(1, packed::size(5));
+  packed::pack(repacked.row(0), expected);
+  REQUIRE(repacked.row(0).isApprox(model.getAggrDot(0).row(1), approx_epsilon<aggr_type>()));
+}
+
+TEST_CASE( "Model/predict_batch", "Test if batched gather-dot predictions match per-element predictions") {
+  init_bmrng(1234);
+  for (int K : {8, 5})
+  {
+    // 2 modes: a row against 21 columns, tiles and tail
+    Model model;
+    model.init(K, PVec<>({4, 30}), ModelInitTypes::random, false, false);
+
+    std::vector<int> cols(21);
+    for (int k = 0; k < 21; ++k) cols[k] = (7 * k + 3) % 30;
+
+    std::vector<double> out(cols.size());
+    model.predict(0, 2, cols.data(), cols.size(), out.data());
+    for (std::size_t k = 0; k < cols.size(); ++k)
+      REQUIRE(out[k] == Catch::Approx(model.predict(PVec<>({2, cols[k]}))).epsilon(approx_epsilon<float_type>()));
+
+    // a column against rows, with an offset on the row index
+    std::vector<int> rows = {3, 1, 2};
+    model.predict(1, 5, rows.data(), rows.size(), out.data(), -1);
+    for (std::size_t k = 0; k < rows.size(); ++k)
+      REQUIRE(out[k] == Catch::Approx(model.predict(PVec<>({rows[k] - 1, 5}))).epsilon(approx_epsilon<float_type>()));
+
+    // 3 modes: runs of items with the same first two coordinates
+    Model tmodel;
+    tmodel.init(K, PVec<>({3, 4, 20}), ModelInitTypes::random, false, false);
+
+    std::vector<PVec<>> coords;
+    for (int i = 0; i < 3; ++i)
+      for (int j = 0; j < 4; ++j)
+        for (int l = 0; l < 20; l += 1 + i + j)
+          coords.push_back(PVec<>({i, j, l}));
+
+    std::vector<double> tout(coords.size());
+    tmodel.predict([&coords](std::size_t k) { return coords[k]; }, coords.size(), tout.data());
+    for (std::size_t k = 0; k < coords.size(); ++k)
+      REQUIRE(tout[k] == Catch::Approx(tmodel.predict(coords[k])).epsilon(approx_epsilon<float_type>()));
+  }
+}
+
+TEST_CASE( "Model/predictSummary", "Test if summary predictions match the moments over all combinations of samples of each mode") {
+  init_bmrng(1234);
+  const int nsamples = 6;
+  const PVec<> dims({3, 4, 5});
+  Model model;
+  model.init(4, dims, ModelInitTypes::random, false, true);
+
+  std::vector<std::vector<Matrix>> samples(3);
+  for (int s = 0; s < nsamples; ++s)
+  {
+    for (int m = 0; m < 3; ++m)
+    {
+      model.U(m) = Matrix::NullaryExpr(dims[m], 4, RandNormalGenerator()).array() + 0.5 * m;
+      samples[m].push_back(model.U(m));
+      for (int i = 0; i < dims[m]; ++i) model.updateAggr(m, i);
+      model.updateAggr(m);
+    }
+  }
+  REQUIRE(model.hasAggr());
+
+  // rows of different modes independent: every combination of samples is equally likely
+  const PVec<> pos({2, 1, 3});
+  double sum = 0.0, sumsq = 0.0;
+  for (int a = 0; a < nsamples; ++a)
+    for (int b = 0; b < nsamples; ++b)
+      for (int c = 0; c < nsamples; ++c)
+      {
+        const double pred = (samples[0][a].row(pos[0]).array() * samples[1][b].row(pos[1]).array() * samples[2][c].row(pos[2]).array()).sum();
+        sum += pred;
+        sumsq += pred * pred;
+      }
+  const double ncomb = std::pow(nsamples, 3);
+  const double expected_mean = sum / ncomb;
+  const double expected_var = sumsq / ncomb - expected_mean * expected_mean;
+
+  double mean, var;
+  model.predictSummary(pos, mean, var);
+  REQUIRE(mean == Catch::Approx(expected_mean).epsilon(approx_epsilon<aggr_type>()));
+  REQUIRE(var == Catch::Approx(expected_var).epsilon(approx_epsilon<aggr_type>()));
+}
+
+TEST_CASE( "PredictSession/used_rows", "Test if predictions from the used rows of a model match those from the full model") {
+  init_bmrng(1234);
+  Model full;
+  full.init(4, PVec<>({6, 5}), ModelInitTypes::random, false, false);
+
+  std::vector<Eigen::Triplet<float_type>> triplets = {{4, 3, 1.0}, {1, 0, 2.0}, {4, 0, 3.0}, {1, 3, 4.0}, {4, 2, 5.0}};
+  SparseMatrix Y(6, 5);
+  Y.setFromTriplets(triplets.begin(), triplets.end());
+
+  Result expected(Y, 1);
+  expected.update(full, false);
+
+  Result actual(Y, 1);
+  std::vector<std::vector<int>> rows;
+  std::vector<PVec<>> coords;
+  used_rows(actual, rows, coords);
+  REQUIRE(rows == std::vector<std::vector<int>>({{1, 4}, {0, 2, 3}}));
+
+  Model part;
+  part.init(4, PVec<>({2, 3}), ModelInitTypes::zero, false, false);
+  for (int m = 0; m < 2; ++m)
+    for (std::size_t i = 0; i < rows[m].size(); ++i)
+      part.U(m).row(i) = full.U(m).row(rows[m][i]);
+
+  actual.update(part, false, coords);
+  REQUIRE(actual.m_predictions.size() == expected.m_predictions.size());
+  for (std::size_t k = 0; k < actual.m_predictions.size(); ++k)
+  {
+    REQUIRE(actual.m_predictions[k].coords == expected.m_predictions[k].coords);
+    REQUIRE(actual.m_predictions[k].pred_avg == Catch::Approx(expected.m_predictions[k].pred_avg));
+  }
+  REQUIRE(actual.rmse_avg == Catch::Approx(expected.rmse_avg));
+}
+
+TEST_CASE( "PredictSession/recommend", "Test if the top-k items over all samples match scoring every item") {
+  init_bmrng(1234);
+  const int nitems = 600; // more than one item tile
+  std::vector<Model> models(3);
+  for (auto &model : models)
+    model.init(4, PVec<>({40, nitems}), ModelInitTypes::random, false, false);
+
+  std::vector<int> rows = {3, 0, 39, 3};
+  for (int i = 1; i < 40; i += 2) rows.push_back(i); // more than one row tile
+  std::vector<std::vector<int>> exclude(rows.size());
+  exclude[0] = {500, 7, 8};
+  exclude[2] = {599};
+
+  const int k = 7;
+  const double ucb = 0.5;
+  Recommendations rec = recommend(models, 0, rows, k, exclude, ucb);
+  REQUIRE(rec.items.rows() == (int)rows.size());
+  REQUIRE(rec.items.cols() == k);
+
+  for (std::size_t i = 0; i < rows.size(); ++i)
+  {
+    std::vector<std::pair<double, int>> expected;
+    for (int j = 0; j < nitems; ++j)
+    {
+      if (std::find(exclude[i].begin(), exclude[i].end(), j) != exclude[i].end()) continue;
+      ResultItem item(PVec<>({rows[i], j}), 0., (int)models.size());
+      for (const auto &model : models) item.update(model.predict(PVec<>({rows[i], j})));
+      expected.push_back({item.pred_avg + ucb * std::sqrt(item.var / (item.nsamples - 1)), j});
+    }
+    std::sort(expected.begin(), expected.end(), std::greater<std::pair<double, int>>());
+
+    for (int j = 0; j < k; ++j)
+    {
+      REQUIRE(rec.items(i, j) == expected[j].second);
+      REQUIRE(rec.scores(i, j) == Catch::Approx(expected[j].first).epsilon(approx_epsilon<float_type>()));
+    }
+  }
+
+  // items scored in several blocks, smaller than an item tile or with a partial last block
+  for (int block_items : {100, 256})
+  {
+    Recommendations blocks = recommend(models, 0, rows, k, exclude, ucb, block_items);
+    REQUIRE(blocks.items == rec.items);
+    REQUIRE(blocks.scores.isApprox(rec.scores));
+  }
+
+  // fewer candidates than k
+  Recommendations all = recommend(models, 1, {5}, nitems + 1, {}, 0.0);
+  REQUIRE(all.items(0, 39) >= 0);
+  REQUIRE(all.items(0, 40) == -1);
+  REQUIRE(std::isnan(all.scores(0, 40)));
+}
+
+TEST_CASE( "LatentIndex/search", "Test if the index finds the exact top-k when probing all lists, and measures recall") {
+  init_bmrng(1234);
+  const Matrix X = Matrix::NullaryExpr(500, 6, RandNormalGenerator());
+  const Matrix Q = Matrix::NullaryExpr(20, 6, RandNormalGenerator());
+  const int k = 5;
+
+  for (auto metric : {IndexMetric::inner_product, IndexMetric::cosine})
+  {
+    LatentIndex index(X, metric, 20, 4);
+    REQUIRE(index.size() == 500);
+    REQUIRE(index.nlist() == 20);
+    REQUIRE(index.getNProbe() == 4);
+    REQUIRE(index.getRecall() >= 0.0);
+    REQUIRE(index.getRecall() <= 1.0);
+
+    LatentIndex::IdMatrix ids;
+    Matrix scores;
+    index.search(Q, k, index.nlist(), ids, scores);
+    for (int i = 0; i < Q.rows(); ++i)
+    {
+      std::vector<std::pair<double, int>> expected;
+      for (int j = 0; j < X.rows(); ++j)
+      {
+        double score = Q.row(i).dot(X.row(j));
+        if (metric == IndexMetric::cosine) score /= Q.row(i).norm() * X.row(j).norm();
+        expected.push_back({score, j});
+      }
+      std::sort(expected.begin(), expected.end(), std::greater<std::pair<double, int>>());
+
+      for (int j = 0; j < k; ++j)
+      {
+        REQUIRE(ids(i, j) == expected[j].second);
+        REQUIRE(scores(i, j) == Catch::Approx(expected[j].first).epsilon(approx_epsilon<float_type>()));
+      }
+    }
+
+    REQUIRE(index.recall(Q, k, index.nlist()) == 1.0);
+    const double recall = index.recall(Q, k, 1);
+    REQUIRE(recall > 0.0);
+    REQUIRE(recall <= index.recall(Q, k, 10));
+
+    // recall measured with other queries than the indexed rows
+    index.measureRecall(Q);
+    REQUIRE(index.getRecall() == index.recall(Q, LatentIndex::RECALL_K, index.getNProbe()));
+
+    // every row is in exactly one list
+    std::vector<int> all;
+    std::vector<float_type> all_scores;
+    index.search(Q.row(0), X.rows() + 1, index.nlist(), all, all_scores);
+    std::sort(all.begin(), all.end());
+    REQUIRE(all.size() == (std::size_t)X.rows());
+    REQUIRE(std::adjacent_find(all.begin(), all.end()) == all.end());
+  }
+}
+
+TEST_CASE( "SparseMatrixData/sumsq", "Test if sum of squared errors of fully known Sparse Matrix is correctly calculated") {
+  std::vector<std::uint32_t> rows = {0, 1, 2};
+  std::vector<std::uint32_t> cols = {0, 2, 1};
+  std::vector<double>        vals = {1., 2., -3.};
+
+  const SparseMatrix S = matrix_utils::sparse_to_eigen(SparseTensor( {3, 4}, { rows, cols }, vals));
+  std::shared_ptr<Data> data(new SparseMatrixData(S));
+
+  data->setNoiseModel(NoiseFactory::create_noise_model(fixed_ncfg));
+  data->init();
+
+  init_bmrng(1234);
+  Model model;
+  model.init(3, PVec<>({3, 4}), ModelInitTypes::random, false);
+
+  // all cells, including implicit zeroes
+  const Matrix Y(S);
+  double expected = 0.0;
+  for (int r = 0; r < 3; ++r)
+    for (int c = 0; c < 4; ++c)
+      expected += std::pow(model.predict({r, c}) - Y(r, c), 2);
+
+  REQUIRE(data->sumsq(model) == Catch::Approx(expected));
+}
+
 TEST_CASE( "DenseMatrixData/var_total", "Test if variance of Dense Matrix is correctly calculated") {
   Matrix Y(2, 2);
   Y << 1., 2., 3., 4.;
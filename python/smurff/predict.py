@@ -7,8 +7,25 @@ import h5sparse
 from .result import Prediction
 from . import wrapper
 
+def decode(dataset):
+    """Reads a dataset, decoding latent matrices saved with sample_storage "float16" or "uint8"."""
+    data = dataset[()]
+    encoding = dataset.attrs.get("encoding")
+    if isinstance(encoding, bytes):
+        encoding = encoding.decode()
+
+    if encoding is None:
+        return data
+    if encoding == "float16":
+        return data.view(np.float16).astype(np.float64)
+    if encoding == "uint8":
+        return dataset.attrs["offset"] + dataset.attrs["scale"] * data
+
+    raise ValueError("Unknown encoding %s of %s" % (encoding, dataset.name))
+
 class Sample:
     def __init__(self, h5_file, name, num_latent):
+        self.name = name
         self.h5_group = h5_file[name]
         self.no = int(self.h5_group.attrs["number"])
         self.nmodes = h5_file["config/options"].attrs['num_priors']
@@ -32,7 +49,7 @@ class Sample:
         return self.h5_group["predictions/pred_var"][()]
 
     def lookup_mode(self, templ, mode):
-        return self.h5_group[templ % mode][()]
+        return decode(self.h5_group[templ % mode])
 
     def lookup_modes(self, templ):
         return [ self.lookup_mode(templ, i) for i in range(self.nmodes) ]
@@ -45,8 +62,17 @@ class Sample:
     def postMuLambda(self, mode):
         mu = self.lookup_mode("latents/post_mu_%d", mode)
         Lambda = self.lookup_mode("latents/post_lambda_%d", mode)
-        assert Lambda.shape[1] == self.num_latent * self.num_latent
-        Lambda = Lambda.reshape(Lambda.shape[0], self.num_latent, self.num_latent)
+        K = self.num_latent
+        if Lambda.shape[1] == K * (K + 1) // 2:
+            # packed lower triangle, row by row
+            rows, cols = np.tril_indices(K)
+            packed = Lambda
+            Lambda = np.empty((packed.shape[0], K, K), dtype=packed.dtype)
+            Lambda[:, rows, cols] = packed
+            Lambda[:, cols, rows] = packed
+        else:
+            assert Lambda.shape[1] == K * K
+            Lambda = Lambda.reshape(Lambda.shape[0], K, K)
 
         return mu, Lambda
 
@@ -116,6 +142,7 @@ class PredictSession:
            Name of the HDF5 file.
  
         """
+        self.h5_fname = h5_fname
         self.h5_file = h5sparse.File(h5_fname, 'r')
         self.options = self.h5_file["config/options"].attrs
         self.nmodes = int(self.options['num_priors'])
@@ -223,6 +250,100 @@ class PredictSession:
             for s in self.samples
         ]
 
+    def predict_summary(self, test_matrix):
+        """Computes predictions for all elements in a sparse test matrix or tensor in
+        one pass, from the posterior mean and second moment of each row saved with
+        the last checkpoint, instead of averaging over all samples. The model must
+        have been trained with `checkpoint_freq` set.
+
+        The predictive mean and variance are moment matched, assuming the rows of
+        different modes are independent. They are compared against averaging over
+        all samples on up to 1000 of the elements.
+
+        Parameters
+        ----------
+        test_matrix : scipy sparse matrix or :class:`SparseTensor`
+
+        Returns
+        -------
+        tuple
+            list of :class:`ResultItem` with `pred_avg` and `var` (`nsamples` times the variance),
+            and a dict with the number of elements compared and the RMSE of the predictive
+            mean (`mean_rmse`) and standard deviation (`std_rmse`)
+        """
+        def summary(session):
+            return session.predictSummary(test_matrix), session.getSummaryError()
+
+        return self._native(summary)
+
+    def recommend(self, rows, k, exclude = None, ucb = 0.0, mode = 0):
+        """Finds the `k` best items for each of `rows`, scored over all samples
+        without computing the full prediction matrix.
+
+        Parameters
+        ----------
+        rows : list of int
+            Rows in `mode` to recommend items for.
+        k : int
+            Number of items per row.
+        exclude : list of list of int or None
+            Items not to recommend to each row, for example the items already rated.
+        ucb : float
+            Score is the posterior mean plus `ucb` times the posterior standard deviation;
+            0 ranks by the mean.
+        mode : int
+            Mode of `rows`, items are from the other mode. Only models with two modes are supported.
+
+        Returns
+        -------
+        tuple of numpy.ndarray
+            items and scores of shape `[ len(rows) x k ]`, best first; -1 and NaN
+            where a row has fewer than `k` candidates
+        """
+        rec = self._native(lambda s: s.recommend(list(rows), k, exclude or [], ucb, mode))
+        return rec.items, rec.scores
+
+    def index(self, mode, metric = "inner_product", nlist = 0, nprobe = 0):
+        """Approximate nearest-neighbour index over the posterior mean (the
+        average over all samples) of the latent vectors of `mode`, stored in
+        the HDF5 file next to the samples.
+
+        It is rebuilt when the file has no index for `mode`, or one built from
+        an older sample or with other settings.
+
+        Parameters
+        ----------
+        mode : int
+            Mode whose latent vectors are indexed, e.g. 1 for the items of a matrix.
+        metric : string
+            "inner_product" to find the best items for a user vector, "cosine" to
+            find the items most similar to an item vector.
+        nlist : int
+            Number of lists (k-means clusters), 0 for about sqrt(rows).
+        nprobe : int
+            Lists scanned per query by default, 0 for about nlist / 8.
+
+        Returns
+        -------
+        LatentIndex
+            `index.search(queries, k)` returns ids and scores of shape `[ len(queries) x k ]`,
+            `index.recall` is its recall measured against exact search, with
+            vectors of the other mode as queries for "inner_product".
+        """
+        return self._native(lambda s: s.getIndex(mode, metric, nlist, nprobe))
+
+    def _native(self, call):
+        # calls call with the C++ PredictSession on the same file, which opens it
+        # read-write: HDF5 does not allow that while it is open read-only here
+        self.h5_file.close()
+        try:
+            return call(wrapper.PredictSession(self.h5_fname))
+        finally:
+            self.h5_file = h5sparse.File(self.h5_fname, 'r')
+            self.options = self.h5_file["config/options"].attrs
+            for sample in self.samples:
+                sample.h5_group = self.h5_file[sample.name]
+
     def __str__(self):
         dat = (len(self.samples), self.data_shape, self.beta_shape, self.num_latent)
         return "PredictSession with %d samples\n  Data shape = %s\n  Beta shape = %s\n  Num latent = %d" % dat
@@ -54,6 +54,47 @@ class TrainSession(PythonSession):
     checkpoint_freq: int
         Save the state of the trainSession every N seconds.
 
+    gather_kernel: bool
+        Use the gather + SYRK kernel for train data with missing values (default True).
+        Set to False to use the rank-1 update kernel instead.
+
+    residual_cache: bool
+        Keep the residuals of train data with missing values in memory (one value per non-zero),
+        so the noise update and train RMSE need no extra pass over the data (default False).
+
+    deferred_stats: bool
+        Compute the sums of U and U^T * U needed by the prior with one matrix product after
+        each sweep, instead of accumulating them per sampled row (default False).
+
+    degree_schedule: bool
+        Sample the rows with the most observations first, one task per row, so heavy rows
+        do not keep a few threads busy at the end of a sweep (default False).
+
+    transposed_values: bool
+        Keep a column-ordered copy of the values of sparse train matrices, so sampling the
+        columns reads them sequentially (default False). By default the columns read the
+        values of the rows through a permutation, which needs less memory.
+
+    mmap_data: bool
+        Save sparse train data in the state file together with its transposed index (default False).
+        A session restored from that file maps the data instead of reading it: start-up does not
+        depend on the size of the data, and processes on the same host share it in the page cache.
+
+    async_save: bool
+        Write samples and checkpoints on a background thread, from a copy of the model and
+        predictions, while sampling continues (default False). At most two saves are in flight;
+        sampling waits when both are. The state file is complete when the session has finished.
+
+    sample_storage: str
+        How the latent matrices of saved samples are stored: "full" (default), "float16",
+        or "uint8" with a scale and offset per column. The lossy encodings record their
+        largest absolute error in the "max_abs_error" attribute of each matrix. Checkpoints
+        are always stored in full.
+
+    sample_compression: int
+        Deflate level (1-9) of the chunked latent matrices of samples and checkpoints
+        (default 0, not compressed).
+
     """
     #
     # construction functions
@@ -70,6 +111,15 @@ class TrainSession(PythonSession):
         save_name        = None,
         save_freq        = None,
         checkpoint_freq  = None,
+        gather_kernel    = None,
+        residual_cache   = None,
+        deferred_stats   = None,
+        degree_schedule  = None,
+        transposed_values = None,
+        mmap_data        = None,
+        async_save       = None,
+        sample_storage   = None,
+        sample_compression = None,
         ):
 
         super().__init__()
@@ -82,6 +132,15 @@ class TrainSession(PythonSession):
         if seed is not None:            self.setRandomSeed(seed)
         if threshold is not None:       self.setThreshold(threshold)
         if verbose is not None:         self.setVerbose(verbose)
+        if gather_kernel is not None:   self.setGatherKernel(gather_kernel)
+        if residual_cache is not None:  self.setResidualCache(residual_cache)
+        if deferred_stats is not None:  self.setDeferredStats(deferred_stats)
+        if degree_schedule is not None: self.setDegreeSchedule(degree_schedule)
+        if transposed_values is not None: self.setTransposedValues(transposed_values)
+        if mmap_data is not None:       self.setMmapData(mmap_data)
+        if async_save is not None:      self.setAsyncSave(async_save)
+        if sample_storage is not None:  self.setSampleStorage(sample_storage)
+        if sample_compression is not None: self.setSampleCompression(sample_compression)
 
         if save_freq is not None:
             self.setSaveFreq(save_freq)
@@ -1,3 +1,5 @@
+#include <sstream>
+
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <pybind11/numpy.h>
@@ -75,6 +77,11 @@ PYBIND11_MODULE(wrapper, m)
         .def_readonly("pred_all", &smurff::ResultItem::pred_all)
         ;
 
+    py::class_<smurff::Recommendations>(m, "Recommendations", "Best items of each row, best first")
+        .def_readonly("items", &smurff::Recommendations::items, "Item ids, -1 where a row has fewer candidates")
+        .def_readonly("scores", &smurff::Recommendations::scores, "Item scores, NaN where a row has fewer candidates")
+        ;
+
     py::class_<smurff::SparseTensor>(m, "SparseTensor")
         .def(py::init<
           const std::vector<std::uint64_t> &,
@@ -106,6 +113,15 @@ PYBIND11_MODULE(wrapper, m)
         .def("setNumLatent", &smurff::PythonSession::setNumLatent)
         .def("setNumThreads", &smurff::PythonSession::setNumThreads)
         .def("setThreshold", &smurff::PythonSession::setThreshold)
+        .def("setGatherKernel", &smurff::PythonSession::setGatherKernel)
+        .def("setResidualCache", &smurff::PythonSession::setResidualCache)
+        .def("setDeferredStats", &smurff::PythonSession::setDeferredStats)
+        .def("setDegreeSchedule", &smurff::PythonSession::setDegreeSchedule)
+        .def("setTransposedValues", &smurff::PythonSession::setTransposedValues)
+        .def("setMmapData", &smurff::PythonSession::setMmapData)
+        .def("setAsyncSave", &smurff::PythonSession::setAsyncSave)
+        .def("setSampleStorage", &smurff::PythonSession::setSampleStorage)
+        .def("setSampleCompression", &smurff::PythonSession::setSampleCompression)
 
         .def("setTest", &smurff::PythonSession::setTest<smurff::SparseMatrix>)
         .def("setTest", &smurff::PythonSession::setTest<smurff::SparseTensor>)
@@ -141,6 +157,71 @@ PYBIND11_MODULE(wrapper, m)
         .def("interrupted", &smurff::PythonSession::interrupted)
         ;
 
+    py::class_<smurff::LatentIndex>(m, "LatentIndex", "Approximate nearest-neighbour index over latent vectors")
+        .def("__str__", [](const smurff::LatentIndex &i) { std::stringstream ss; i.info(ss, ""); return ss.str(); })
+        .def_property_readonly("size", &smurff::LatentIndex::size)
+        .def_property_readonly("nlist", &smurff::LatentIndex::nlist)
+        .def_property_readonly("nprobe", &smurff::LatentIndex::getNProbe)
+        .def_property_readonly("recall", &smurff::LatentIndex::getRecall, "Recall of the top 10 measured against exact search at build")
+        .def_property_readonly("metric", [](const smurff::LatentIndex &i) { return smurff::indexMetricToString(i.getMetric()); })
+        .def("search", [](const smurff::LatentIndex &i, const smurff::Matrix &queries, int k, int nprobe) {
+                smurff::LatentIndex::IdMatrix ids;
+                smurff::Matrix scores;
+                {
+                    py::gil_scoped_release release;
+                    i.search(queries, k, nprobe, ids, scores);
+                }
+                return py::make_tuple(ids, scores);
+            },
+           py::arg("queries"),
+           py::arg("k"),
+           py::arg("nprobe") = 0
+        )
+        .def("recall", &smurff::LatentIndex::recall,
+           py::arg("queries"),
+           py::arg("k"),
+           py::arg("nprobe") = 0,
+           py::call_guard<py::gil_scoped_release>()
+        )
+        ;
+
+    py::class_<smurff::PredictSession>(m, "PredictSession")
+        .def(py::init<const std::string &>())
+        .def("__str__", &smurff::ISession::infoAsString)
+        .def("getNumSteps", &smurff::PredictSession::getNumSteps)
+        .def("getNumLatent", &smurff::PredictSession::getNumLatent)
+        .def("recommend", &smurff::PredictSession::recommend,
+           py::arg("rows"),
+           py::arg("k"),
+           py::arg("exclude") = std::vector<std::vector<int>>(),
+           py::arg("ucb") = 0.0,
+           py::arg("mode") = 0,
+           py::call_guard<py::gil_scoped_release>()
+        )
+        .def("getIndex", [](smurff::PredictSession &s, int mode, const std::string &metric, int nlist, int nprobe) {
+                return s.getIndex(mode, smurff::stringToIndexMetric(metric), nlist, nprobe);
+            },
+           py::arg("mode"),
+           py::arg("metric") = "inner_product",
+           py::arg("nlist") = 0,
+           py::arg("nprobe") = 0
+        )
+        .def("predictSummary", [](smurff::PredictSession &s, const smurff::SparseMatrix &Y) {
+                smurff::DataConfig test;
+                test.setData(Y, true);
+                return s.predictSummary(test)->m_predictions;
+            })
+        .def("predictSummary", [](smurff::PredictSession &s, const smurff::SparseTensor &Y) {
+                smurff::DataConfig test;
+                test.setData(Y, true);
+                return s.predictSummary(test)->m_predictions;
+            })
+        .def("getSummaryError", [](const smurff::PredictSession &s) {
+                const auto &e = s.getSummaryError();
+                return py::dict(py::arg("items") = e.items, py::arg("mean_rmse") = e.mean_rmse, py::arg("std_rmse") = e.std_rmse);
+            })
+        ;
+
     m.def("predict", &smurff::predict_matrix, "Predict helper function");
     m.def("predict", &smurff::predict_tensor, "Predict helper function");
 
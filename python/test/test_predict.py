@@ -15,19 +15,21 @@ class TestPredictSession(unittest.TestCase):
     # Python 2.7 @unittest.skip fix
     __name__ = "TestPredictSession"
 
-    def run_train_session(self, nmodes, density):
-        shape = range(5, nmodes+5) # 5, 6, 7, ...
+    def run_train_session(self, nmodes, density, shape = None, side_info = True, **kwargs):
+        if shape is None:
+            shape = range(5, nmodes+5) # 5, 6, 7, ...
         Y, X = smurff.generate.gen_tensor(shape, 3, density)
         self.Ytrain, self.Ytest = smurff.make_train_test(Y, 0.1)
         priors = ['normal'] * nmodes
 
         trainSession = smurff.TrainSession(priors = priors, num_latent=4,
                 burnin=10, nsamples=nsamples, verbose=verbose, num_threads=1,
-                save_freq = 1, save_name = smurff.helper.temp_savename())
+                save_freq = 1, save_name = smurff.helper.temp_savename(), **kwargs)
 
         trainSession.addTrainAndTest(self.Ytrain, self.Ytest)
-        for i, x in enumerate(X):
-            trainSession.addSideInfo(i, x)
+        if side_info:
+            for i, x in enumerate(X):
+                trainSession.addSideInfo(i, x)
 
         trainSession.init()
         while trainSession.step():
@@ -119,5 +121,99 @@ class TestPredictSession(unittest.TestCase):
     def test_predict_sparse(self, name, nmodes):
         self.run_predict_session(nmodes, 0.5)
 
+    def run_matrix_session(self, **kwargs):
+        train_session, _, _ = self.run_train_session(2, 1.0, shape = (30, 40), side_info = False, **kwargs)
+        return train_session.makePredictSession()
+
+    def post_mean(self, predict_session, mode):
+        return np.mean([ s.latents[mode] for s in predict_session.samples ], axis = 0)
+
+    def assert_predict_after_native(self, predict_session, expected):
+        # the h5py handle was closed and reopened by the native call
+        for s, e in zip(predict_session.samples, expected):
+            assert_almost_equal(s.predict((Ellipsis, Ellipsis)), e)
+
+    @parameterized.expand([ ("inner_product", ), ("cosine", ) ])
+    def test_index(self, metric):
+        predict_session = self.run_matrix_session()
+        before = predict_session.predict_all()
+
+        index = predict_session.index(1, metric, nlist = 4)
+        self.assertEqual(index.size, 40)
+        self.assertEqual(index.nlist, 4)
+        self.assertEqual(index.metric, metric)
+
+        # probing every list is an exact search
+        k = 5
+        items = self.post_mean(predict_session, 1)
+        queries = self.post_mean(predict_session, 0) if metric == "inner_product" else items[:10]
+        ids, scores = index.search(queries, k, index.nlist)
+
+        if metric == "cosine":
+            queries = queries / np.linalg.norm(queries, axis = 1, keepdims = True)
+            items = items / np.linalg.norm(items, axis = 1, keepdims = True)
+        expected = np.dot(queries, items.T)
+        expected_ids = np.argsort(-expected, axis = 1)[:, :k]
+        assert_equal(ids, expected_ids)
+        assert_almost_equal(scores, np.take_along_axis(expected, expected_ids, axis = 1), decimal = 4)
+        self.assertEqual(index.recall(queries, k, index.nlist), 1.0)
+
+        self.assert_predict_after_native(predict_session, before)
+
+    def test_recommend(self):
+        predict_session = self.run_matrix_session()
+        before = predict_session.predict_all()
+
+        rows, k = [ 0, 3, 29 ], 5
+        exclude = [ [ 1, 2 ], [], list(range(38)) ]
+        items, scores = predict_session.recommend(rows, k, exclude)
+        self.assertEqual(items.shape, (len(rows), k))
+
+        # posterior mean of each prediction, over all samples
+        mean = np.mean(before, axis = 0)
+        for r, (row, excl) in enumerate(zip(rows, exclude)):
+            candidates = [ j for j in np.argsort(-mean[row]) if j not in excl ][:k]
+            n = len(candidates)
+            assert_equal(items[r, :n], candidates)
+            assert_almost_equal(scores[r, :n], mean[row, candidates])
+            assert_equal(items[r, n:], -1)
+            self.assertTrue(np.all(np.isnan(scores[r, n:])))
+
+        self.assert_predict_after_native(predict_session, before)
+
+    def test_predict_summary(self):
+        predict_session = self.run_matrix_session(checkpoint_freq = 1)
+        before = predict_session.predict_all()
+
+        items, error = predict_session.predict_summary(self.Ytest)
+        self.assertEqual(len(items), self.Ytest.nnz)
+        self.assertEqual(error["items"], self.Ytest.nnz)
+        self.assertTrue(np.isfinite(error["mean_rmse"]))
+        self.assertTrue(np.isfinite(error["std_rmse"]))
+
+        # with the modes independent, the predictive mean is the product of the posterior means
+        mean = np.dot(self.post_mean(predict_session, 0), self.post_mean(predict_session, 1).T)
+        for item in items:
+            self.assertAlmostEqual(item.pred_avg, mean[item.coords], places = 6)
+            self.assertEqual(item.nsamples, nsamples)
+
+        self.assert_predict_after_native(predict_session, before)
+
+    @parameterized.expand([ ("float16", ), ("uint8", ) ])
+    def test_decode(self, storage):
+        predict_session = self.run_matrix_session(sample_storage = storage)
+
+        for s in predict_session.samples:
+            for mode in range(2):
+                dataset = s.h5_group["latents/latents_%d" % mode]
+                self.assertEqual(dataset.attrs["encoding"], storage)
+                self.assertEqual(s.latents[mode].dtype, np.float64)
+                self.assertEqual(s.latents[mode].shape, (30 + 10 * mode, 4))
+
+        # Python decoding matches the C++ one
+        for sparse, s in zip(predict_session.predict_sparse(self.Ytest), predict_session.samples):
+            coords, values = smurff.find(sparse)
+            assert_almost_equal([ s.predict(c).item() for c in zip(*coords) ], values, decimal = 4)
+
 if __name__ == '__main__':
     unittest.main()